@@ -0,0 +1,794 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Throughput and latency of the _ZGVnN* entry points against scalar
+   libm.  Build with
+
+     gcc -O2 -o libmvec-bench bench/libmvec_bench.c libmvec.a -lm
+
+   where libmvec.a holds the libmvec objects, and run
+
+     ./libmvec-bench [-t SECONDS] [FUNCTION...] > bench.csv
+
+   Every function is measured over the input distributions that apply
+   to it:
+
+     range    uniform over the domain the main path covers
+     near1    [0.9, 1.1], for the log functions and the x of pow
+     special  range, with one input in eight replaced by nan, inf,
+	      zero, a subnormal or an input outside the domain
+     large    arguments that leave the main path: |x| above the sin
+	      and cos reduction cutoff, exp results that overflow or
+	      underflow
+
+   Each row of the CSV output is
+
+     function,impl,distribution,metric,ns_per_element
+
+   where impl is vector for the entry point, array for the mvec_*
+   array function over the whole buffer and scalar for the libm
+   function, and metric is throughput (independent calls over a
+   buffer that stays in L1) or latency (each call waits for the
+   result of the previous one).  The array functions are timed for
+   throughput only.  The minimum over several runs is reported.
+
+   Built with -DLIBMVEC_BENCH_INLINE and the include paths of the
+   libmvec build, the driver also times the kernels of
+   libmvec_inline.h in the same loops, as impl inline, and once more
+   with a compiler barrier after every step, as impl reload.  The
+   inline loop keeps the constants in registers, the reload loop
+   loads the coefficient blocks again on every step as the entry
+   point does on every call.  The difference between the reload and
+   the inline rows is the cost of those loads, the difference between
+   the vector and the reload rows the rest of the overhead of a call:
+   the branch and return and the spills around it when the caller
+   does not use the vector PCS.  */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../libmvec_array.h"
+
+#ifdef LIBMVEC_BENCH_INLINE
+# include "libmvec_inline.h"
+#endif
+
+/* The vector types of the AArch64 vector function ABI.  Generic GCC
+   vectors are passed in the same registers as __Float64x2_t.  */
+typedef double v2df __attribute__ ((vector_size (16)));
+typedef float v4sf __attribute__ ((vector_size (16)));
+typedef uint64_t v2di __attribute__ ((vector_size (16)));
+typedef uint32_t v4si __attribute__ ((vector_size (16)));
+
+#define DECL_V2DF(f) extern v2df _ZGVnN2v_##f (v2df);
+#define DECL_V2DF2(f) extern v2df _ZGVnN2vv_##f (v2df, v2df);
+#define DECL_V4SF(f) extern v4sf _ZGVnN4v_##f (v4sf);
+#define DECL_V4SF2(f) extern v4sf _ZGVnN4vv_##f (v4sf, v4sf);
+
+DECL_V2DF (exp) DECL_V2DF (exp2) DECL_V2DF (exp10) DECL_V2DF (expm1)
+DECL_V2DF (log) DECL_V2DF (log2) DECL_V2DF (log10) DECL_V2DF (log1p)
+DECL_V2DF2 (pow) DECL_V2DF (sin) DECL_V2DF (cos) DECL_V2DF (tan)
+DECL_V2DF (atan) DECL_V2DF2 (atan2) DECL_V2DF (asin) DECL_V2DF (acos)
+DECL_V2DF (sinh) DECL_V2DF (cosh) DECL_V2DF (tanh)
+DECL_V4SF (expf) DECL_V4SF (exp2f) DECL_V4SF (exp10f) DECL_V4SF (expm1f)
+DECL_V4SF (logf) DECL_V4SF (log2f) DECL_V4SF (log10f) DECL_V4SF (log1pf)
+DECL_V4SF2 (powf) DECL_V4SF (sinf) DECL_V4SF (cosf) DECL_V4SF (tanf)
+DECL_V4SF (atanf) DECL_V4SF2 (atan2f) DECL_V4SF (asinf) DECL_V4SF (acosf)
+DECL_V4SF (sinhf) DECL_V4SF (coshf) DECL_V4SF (tanhf)
+extern void _ZGVnN2vl8l8_sincos (v2df, double *, double *);
+extern void _ZGVnN4vl4l4_sincosf (v4sf, float *, float *);
+
+enum kind { V2DF, V2DF2, V4SF, V4SF2, SINCOS, SINCOSF };
+
+enum dist { RANGE, NEAR1, SPECIAL, LARGE, NDIST };
+
+#define D_RANGE (1 << RANGE)
+#define D_NEAR1 (1 << NEAR1)
+#define D_SPECIAL (1 << SPECIAL)
+#define D_LARGE (1 << LARGE)
+
+static const char *const dist_names[NDIST] =
+  { "range", "near1", "special", "large" };
+
+struct func
+{
+  const char *name;
+  enum kind kind;
+  void (*vec) (void);
+  void (*scalar) (void);
+  /* The in-range domain, the range of the second argument and the
+     magnitudes of the large arguments.  */
+  double lo, hi, lo2, hi2, large_lo, large_hi;
+  unsigned dists;
+};
+
+#define F(name, kind, vec, scalar, lo, hi, lo2, hi2, llo, lhi, dists)	\
+  { name, kind, (void (*) (void)) vec, (void (*) (void)) scalar,	\
+    lo, hi, lo2, hi2, llo, lhi, dists }
+
+#define EXPD (D_RANGE | D_SPECIAL | D_LARGE)
+#define LOGD (D_RANGE | D_NEAR1 | D_SPECIAL)
+#define TRIGD (D_RANGE | D_SPECIAL | D_LARGE)
+#define OTHERD (D_RANGE | D_SPECIAL)
+
+static const struct func funcs[] = {
+  F ("exp", V2DF, _ZGVnN2v_exp, exp, -700, 700, 0, 0, 710, 800, EXPD),
+  F ("exp2", V2DF, _ZGVnN2v_exp2, exp2, -1000, 1000, 0, 0, 1025, 1100,
+     EXPD),
+  F ("exp10", V2DF, _ZGVnN2v_exp10, exp10, -300, 300, 0, 0, 309, 350,
+     EXPD),
+  F ("expm1", V2DF, _ZGVnN2v_expm1, expm1, -700, 700, 0, 0, 710, 800,
+     EXPD),
+  F ("log", V2DF, _ZGVnN2v_log, log, 1e-300, 1e300, 0, 0, 0, 0, LOGD),
+  F ("log2", V2DF, _ZGVnN2v_log2, log2, 1e-300, 1e300, 0, 0, 0, 0, LOGD),
+  F ("log10", V2DF, _ZGVnN2v_log10, log10, 1e-300, 1e300, 0, 0, 0, 0,
+     LOGD),
+  F ("log1p", V2DF, _ZGVnN2v_log1p, log1p, -0.9, 1e300, 0, 0, 0, 0,
+     OTHERD),
+  F ("pow", V2DF2, _ZGVnN2vv_pow, pow, 0.01, 100, -50, 50, 0, 0, LOGD),
+  F ("sin", V2DF, _ZGVnN2v_sin, sin, -100, 100, 0, 0, 1e3, 1e300, TRIGD),
+  F ("cos", V2DF, _ZGVnN2v_cos, cos, -100, 100, 0, 0, 1e3, 1e300, TRIGD),
+  F ("sincos", SINCOS, _ZGVnN2vl8l8_sincos, sincos, -100, 100, 0, 0, 1e3,
+     1e300, TRIGD),
+  F ("tan", V2DF, _ZGVnN2v_tan, tan, -100, 100, 0, 0, 1e3, 1e300, TRIGD),
+  F ("atan", V2DF, _ZGVnN2v_atan, atan, -1e3, 1e3, 0, 0, 0, 0, OTHERD),
+  F ("atan2", V2DF2, _ZGVnN2vv_atan2, atan2, -1e3, 1e3, -1e3, 1e3, 0, 0,
+     OTHERD),
+  F ("asin", V2DF, _ZGVnN2v_asin, asin, -1, 1, 0, 0, 0, 0, OTHERD),
+  F ("acos", V2DF, _ZGVnN2v_acos, acos, -1, 1, 0, 0, 0, 0, OTHERD),
+  F ("sinh", V2DF, _ZGVnN2v_sinh, sinh, -700, 700, 0, 0, 710, 800, EXPD),
+  F ("cosh", V2DF, _ZGVnN2v_cosh, cosh, -700, 700, 0, 0, 710, 800, EXPD),
+  F ("tanh", V2DF, _ZGVnN2v_tanh, tanh, -20, 20, 0, 0, 0, 0, OTHERD),
+  F ("expf", V4SF, _ZGVnN4v_expf, expf, -87, 88, 0, 0, 89, 110, EXPD),
+  F ("exp2f", V4SF, _ZGVnN4v_exp2f, exp2f, -126, 127, 0, 0, 128, 160,
+     EXPD),
+  F ("exp10f", V4SF, _ZGVnN4v_exp10f, exp10f, -37, 38, 0, 0, 39, 50,
+     EXPD),
+  F ("expm1f", V4SF, _ZGVnN4v_expm1f, expm1f, -87, 88, 0, 0, 89, 110,
+     EXPD),
+  F ("logf", V4SF, _ZGVnN4v_logf, logf, 1e-37, 1e37, 0, 0, 0, 0, LOGD),
+  F ("log2f", V4SF, _ZGVnN4v_log2f, log2f, 1e-37, 1e37, 0, 0, 0, 0, LOGD),
+  F ("log10f", V4SF, _ZGVnN4v_log10f, log10f, 1e-37, 1e37, 0, 0, 0, 0,
+     LOGD),
+  F ("log1pf", V4SF, _ZGVnN4v_log1pf, log1pf, -0.9, 1e37, 0, 0, 0, 0,
+     OTHERD),
+  F ("powf", V4SF2, _ZGVnN4vv_powf, powf, 0.01, 100, -10, 10, 0, 0, LOGD),
+  F ("sinf", V4SF, _ZGVnN4v_sinf, sinf, -100, 100, 0, 0, 1e5, 1e38,
+     TRIGD),
+  F ("cosf", V4SF, _ZGVnN4v_cosf, cosf, -100, 100, 0, 0, 1e5, 1e38,
+     TRIGD),
+  F ("sincosf", SINCOSF, _ZGVnN4vl4l4_sincosf, sincosf, -100, 100, 0, 0,
+     1e5, 1e38, TRIGD),
+  F ("tanf", V4SF, _ZGVnN4v_tanf, tanf, -100, 100, 0, 0, 1e5, 1e38,
+     TRIGD),
+  F ("atanf", V4SF, _ZGVnN4v_atanf, atanf, -1e3, 1e3, 0, 0, 0, 0, OTHERD),
+  F ("atan2f", V4SF2, _ZGVnN4vv_atan2f, atan2f, -1e3, 1e3, -1e3, 1e3, 0,
+     0, OTHERD),
+  F ("asinf", V4SF, _ZGVnN4v_asinf, asinf, -1, 1, 0, 0, 0, 0, OTHERD),
+  F ("acosf", V4SF, _ZGVnN4v_acosf, acosf, -1, 1, 0, 0, 0, 0, OTHERD),
+  F ("sinhf", V4SF, _ZGVnN4v_sinhf, sinhf, -88, 88, 0, 0, 90, 110, EXPD),
+  F ("coshf", V4SF, _ZGVnN4v_coshf, coshf, -88, 88, 0, 0, 90, 110, EXPD),
+  F ("tanhf", V4SF, _ZGVnN4v_tanhf, tanhf, -10, 10, 0, 0, 0, 0, OTHERD),
+};
+
+/* Elements per buffer, a multiple of every vector length.  */
+#define N 1024
+
+static double din[N], din2[N], dout[N], dout2[N];
+static float fin[N], fin2[N], fout[N], fout2[N];
+
+/* Read at run time so that the compiler cannot drop the dependency
+   the latency loops create through it.  */
+static volatile uint64_t zero_bits;
+
+static double min_time = 0.05;
+
+static uint64_t rng_state = 0x9e3779b97f4a7c15;
+
+static double
+rand_unit (void)
+{
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 7;
+  rng_state ^= rng_state << 17;
+  return (rng_state >> 11) * 0x1p-53;
+}
+
+/* Uniform in [LO, HI], or log-uniform in magnitude when the interval
+   spans many binades.  */
+static double
+rand_in (double lo, double hi)
+{
+  if (lo > 0 && hi / lo > 1e3)
+    return exp (log (lo) + rand_unit () * (log (hi) - log (lo)));
+  return lo + rand_unit () * (hi - lo);
+}
+
+static void
+fill (const struct func *f, enum dist d)
+{
+  static const double special[] =
+    { NAN, INFINITY, -INFINITY, 0.0, -0.0, 0x1p-1060, -1.0, 1e300 };
+  static const float specialf[] =
+    { NAN, INFINITY, -INFINITY, 0.0f, -0.0f, 0x1p-140f, -1.0f, 1e38f };
+  int i;
+
+  for (i = 0; i < N; i++)
+    {
+      double x, y = rand_in (f->lo2, f->hi2);
+
+      switch (d)
+	{
+	case NEAR1:
+	  x = rand_in (0.9, 1.1);
+	  break;
+	case LARGE:
+	  x = rand_in (f->large_lo, f->large_hi);
+	  if (rand_unit () < 0.5)
+	    x = -x;
+	  break;
+	default:
+	  x = rand_in (f->lo, f->hi);
+	  break;
+	}
+      din[i] = x;
+      din2[i] = y;
+      fin[i] = x;
+      fin2[i] = y;
+      if (d == SPECIAL && i % 8 == 7)
+	{
+	  int k = (i / 8) % 8;
+	  din[i] = special[k];
+	  fin[i] = specialf[k];
+	}
+    }
+}
+
+static double
+now (void)
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* One pass over the buffer.  LATENCY makes every call depend on the
+   previous result: its bits are masked with zero and or-ed into the
+   next input, which leaves the input unchanged.  */
+static void
+run_vector (const struct func *f, int latency)
+{
+  v2di dz = { zero_bits, zero_bits };
+  v4si fz = { (uint32_t) zero_bits, (uint32_t) zero_bits,
+	      (uint32_t) zero_bits, (uint32_t) zero_bits };
+  v2df dy = { 0, 0 };
+  v4sf fy = { 0, 0, 0, 0 };
+  v2df dx, dx2;
+  v4sf fx, fx2;
+  int i;
+
+  switch (f->kind)
+    {
+    case V2DF:
+      for (i = 0; i < N; i += 2)
+	{
+	  memcpy (&dx, din + i, sizeof (dx));
+	  if (latency)
+	    dx = (v2df) ((v2di) dx | ((v2di) dy & dz));
+	  dy = ((v2df (*) (v2df)) f->vec) (dx);
+	  memcpy (dout + i, &dy, sizeof (dy));
+	}
+      break;
+    case V2DF2:
+      for (i = 0; i < N; i += 2)
+	{
+	  memcpy (&dx, din + i, sizeof (dx));
+	  memcpy (&dx2, din2 + i, sizeof (dx2));
+	  if (latency)
+	    dx = (v2df) ((v2di) dx | ((v2di) dy & dz));
+	  dy = ((v2df (*) (v2df, v2df)) f->vec) (dx, dx2);
+	  memcpy (dout + i, &dy, sizeof (dy));
+	}
+      break;
+    case SINCOS:
+      for (i = 0; i < N; i += 2)
+	{
+	  memcpy (&dx, din + i, sizeof (dx));
+	  if (latency)
+	    {
+	      memcpy (&dy, dout + (i + N - 2) % N, sizeof (dy));
+	      dx = (v2df) ((v2di) dx | ((v2di) dy & dz));
+	    }
+	  ((void (*) (v2df, double *, double *)) f->vec) (dx, dout + i,
+							  dout2 + i);
+	}
+      break;
+    case V4SF:
+      for (i = 0; i < N; i += 4)
+	{
+	  memcpy (&fx, fin + i, sizeof (fx));
+	  if (latency)
+	    fx = (v4sf) ((v4si) fx | ((v4si) fy & fz));
+	  fy = ((v4sf (*) (v4sf)) f->vec) (fx);
+	  memcpy (fout + i, &fy, sizeof (fy));
+	}
+      break;
+    case V4SF2:
+      for (i = 0; i < N; i += 4)
+	{
+	  memcpy (&fx, fin + i, sizeof (fx));
+	  memcpy (&fx2, fin2 + i, sizeof (fx2));
+	  if (latency)
+	    fx = (v4sf) ((v4si) fx | ((v4si) fy & fz));
+	  fy = ((v4sf (*) (v4sf, v4sf)) f->vec) (fx, fx2);
+	  memcpy (fout + i, &fy, sizeof (fy));
+	}
+      break;
+    case SINCOSF:
+      for (i = 0; i < N; i += 4)
+	{
+	  memcpy (&fx, fin + i, sizeof (fx));
+	  if (latency)
+	    {
+	      memcpy (&fy, fout + (i + N - 4) % N, sizeof (fy));
+	      fx = (v4sf) ((v4si) fx | ((v4si) fy & fz));
+	    }
+	  ((void (*) (v4sf, float *, float *)) f->vec) (fx, fout + i,
+							fout2 + i);
+	}
+      break;
+    }
+}
+
+static void
+run_scalar (const struct func *f, int latency)
+{
+  uint64_t dz = zero_bits;
+  uint32_t fz = (uint32_t) zero_bits;
+  double dy = 0, dx;
+  float fy = 0, fx;
+  uint64_t u, uy;
+  uint32_t v, vy;
+  int i;
+
+  for (i = 0; i < N; i++)
+    {
+      dx = din[i];
+      fx = fin[i];
+      if (latency)
+	{
+	  memcpy (&u, &dx, sizeof (u));
+	  memcpy (&v, &fx, sizeof (v));
+	  memcpy (&uy, &dy, sizeof (uy));
+	  memcpy (&vy, &fy, sizeof (vy));
+	  u |= uy & dz;
+	  v |= vy & fz;
+	  memcpy (&dx, &u, sizeof (u));
+	  memcpy (&fx, &v, sizeof (v));
+	}
+      switch (f->kind)
+	{
+	case V2DF:
+	  dy = ((double (*) (double)) f->scalar) (dx);
+	  dout[i] = dy;
+	  break;
+	case V2DF2:
+	  dy = ((double (*) (double, double)) f->scalar) (dx, din2[i]);
+	  dout[i] = dy;
+	  break;
+	case SINCOS:
+	  ((void (*) (double, double *, double *)) f->scalar)
+	    (dx, dout + i, dout2 + i);
+	  dy = dout[i];
+	  break;
+	case V4SF:
+	  fy = ((float (*) (float)) f->scalar) (fx);
+	  fout[i] = fy;
+	  break;
+	case V4SF2:
+	  fy = ((float (*) (float, float)) f->scalar) (fx, fin2[i]);
+	  fout[i] = fy;
+	  break;
+	case SINCOSF:
+	  ((void (*) (float, float *, float *)) f->scalar)
+	    (fx, fout + i, fout2 + i);
+	  fy = fout[i];
+	  break;
+	}
+    }
+}
+
+/* The array functions, looked up by name.  */
+static const struct
+{
+  const char *name;
+  void (*array) (void);
+} array_funcs[] = {
+#define A(name) { #name, (void (*) (void)) mvec_##name }
+  A (exp), A (exp2), A (exp10), A (expm1), A (log), A (log2), A (log10),
+  A (log1p), A (pow), A (sin), A (cos), A (sincos), A (tan), A (atan),
+  A (atan2), A (asin), A (acos), A (sinh), A (cosh), A (tanh),
+  A (expf), A (exp2f), A (exp10f), A (expm1f), A (logf), A (log2f),
+  A (log10f), A (log1pf), A (powf), A (sinf), A (cosf), A (sincosf),
+  A (tanf), A (atanf), A (atan2f), A (asinf), A (acosf), A (sinhf),
+  A (coshf), A (tanhf),
+#undef A
+};
+
+/* One call of the array function over the buffer, for comparison with
+   the loop over the entry point in run_vector.  */
+static void
+run_array (const struct func *f, int latency)
+{
+  void (*array) (void) = NULL;
+  size_t i;
+
+  (void) latency;
+  for (i = 0; i < sizeof (array_funcs) / sizeof (array_funcs[0]); i++)
+    if (strcmp (array_funcs[i].name, f->name) == 0)
+      array = array_funcs[i].array;
+  switch (f->kind)
+    {
+    case V2DF:
+      ((void (*) (const double *, double *, size_t)) array) (din, dout, N);
+      break;
+    case V2DF2:
+      ((void (*) (const double *, const double *, double *, size_t)) array)
+	(din, din2, dout, N);
+      break;
+    case SINCOS:
+      ((void (*) (const double *, double *, double *, size_t)) array)
+	(din, dout, dout2, N);
+      break;
+    case V4SF:
+      ((void (*) (const float *, float *, size_t)) array) (fin, fout, N);
+      break;
+    case V4SF2:
+      ((void (*) (const float *, const float *, float *, size_t)) array)
+	(fin, fin2, fout, N);
+      break;
+    case SINCOSF:
+      ((void (*) (const float *, float *, float *, size_t)) array)
+	(fin, fout, fout2, N);
+      break;
+    }
+}
+
+#ifdef LIBMVEC_BENCH_INLINE
+/* The loops of run_vector with the kernel inlined, one function per
+   kernel so that its constants can be hoisted out of the loop.  With
+   RELOAD a compiler barrier after each step makes the loop load the
+   coefficient blocks again on every iteration, as the entry point
+   does on every call.  */
+# define INLINE_RUN(name)						\
+static void								\
+inline_##name (int latency)						\
+{									\
+  loop_##name (latency, 0);						\
+}									\
+									\
+static void								\
+reload_##name (int latency)						\
+{									\
+  loop_##name (latency, 1);						\
+}
+
+# define INLINE_V2DF(name, kernel)					\
+static __always_inline void						\
+loop_##name (int latency, int reload)					\
+{									\
+  v2di dz = { zero_bits, zero_bits };					\
+  v2df dx, dy = { 0, 0 };						\
+  int i;								\
+									\
+  for (i = 0; i < N; i += 2)						\
+    {									\
+      memcpy (&dx, din + i, sizeof (dx));				\
+      if (latency)							\
+	dx = (v2df) ((v2di) dx | ((v2di) dy & dz));			\
+      dy = (v2df) kernel ((__Float64x2_t) dx);				\
+      memcpy (dout + i, &dy, sizeof (dy));				\
+      if (reload)							\
+	__asm__ ("" ::: "memory");					\
+    }									\
+}									\
+INLINE_RUN (name)
+
+# define INLINE_V2DF2(name, kernel)					\
+static __always_inline void						\
+loop_##name (int latency, int reload)					\
+{									\
+  v2di dz = { zero_bits, zero_bits };					\
+  v2df dx, dx2, dy = { 0, 0 };						\
+  int i;								\
+									\
+  for (i = 0; i < N; i += 2)						\
+    {									\
+      memcpy (&dx, din + i, sizeof (dx));				\
+      memcpy (&dx2, din2 + i, sizeof (dx2));				\
+      if (latency)							\
+	dx = (v2df) ((v2di) dx | ((v2di) dy & dz));			\
+      dy = (v2df) kernel ((__Float64x2_t) dx, (__Float64x2_t) dx2);	\
+      memcpy (dout + i, &dy, sizeof (dy));				\
+      if (reload)							\
+	__asm__ ("" ::: "memory");					\
+    }									\
+}									\
+INLINE_RUN (name)
+
+# define INLINE_V4SF(name, kernel)					\
+static __always_inline void						\
+loop_##name (int latency, int reload)					\
+{									\
+  uint32_t z = (uint32_t) zero_bits;					\
+  v4si fz = { z, z, z, z };						\
+  v4sf fx, fy = { 0, 0, 0, 0 };						\
+  int i;								\
+									\
+  for (i = 0; i < N; i += 4)						\
+    {									\
+      memcpy (&fx, fin + i, sizeof (fx));				\
+      if (latency)							\
+	fx = (v4sf) ((v4si) fx | ((v4si) fy & fz));			\
+      fy = (v4sf) kernel ((__Float32x4_t) fx);				\
+      memcpy (fout + i, &fy, sizeof (fy));				\
+      if (reload)							\
+	__asm__ ("" ::: "memory");					\
+    }									\
+}									\
+INLINE_RUN (name)
+
+# define INLINE_V4SF2(name, kernel)					\
+static __always_inline void						\
+loop_##name (int latency, int reload)					\
+{									\
+  uint32_t z = (uint32_t) zero_bits;					\
+  v4si fz = { z, z, z, z };						\
+  v4sf fx, fx2, fy = { 0, 0, 0, 0 };					\
+  int i;								\
+									\
+  for (i = 0; i < N; i += 4)						\
+    {									\
+      memcpy (&fx, fin + i, sizeof (fx));				\
+      memcpy (&fx2, fin2 + i, sizeof (fx2));				\
+      if (latency)							\
+	fx = (v4sf) ((v4si) fx | ((v4si) fy & fz));			\
+      fy = (v4sf) kernel ((__Float32x4_t) fx, (__Float32x4_t) fx2);	\
+      memcpy (fout + i, &fy, sizeof (fy));				\
+      if (reload)							\
+	__asm__ ("" ::: "memory");					\
+    }									\
+}									\
+INLINE_RUN (name)
+
+static __always_inline void
+loop_sincos (int latency, int reload)
+{
+  v2di dz = { zero_bits, zero_bits };
+  __Float64x2_t s, c;
+  v2df dx, dy = { 0, 0 };
+  int i;
+
+  for (i = 0; i < N; i += 2)
+    {
+      memcpy (&dx, din + i, sizeof (dx));
+      if (latency)
+	dx = (v2df) ((v2di) dx | ((v2di) dy & dz));
+      __sincos_v2df ((__Float64x2_t) dx, &s, &c);
+      dy = (v2df) s;
+      memcpy (dout + i, &s, sizeof (s));
+      memcpy (dout2 + i, &c, sizeof (c));
+      if (reload)
+	__asm__ ("" ::: "memory");
+    }
+}
+
+INLINE_RUN (sincos)
+
+static __always_inline void
+loop_sincosf (int latency, int reload)
+{
+  uint32_t z = (uint32_t) zero_bits;
+  v4si fz = { z, z, z, z };
+  __Float32x4_t s, c;
+  v4sf fx, fy = { 0, 0, 0, 0 };
+  int i;
+
+  for (i = 0; i < N; i += 4)
+    {
+      memcpy (&fx, fin + i, sizeof (fx));
+      if (latency)
+	fx = (v4sf) ((v4si) fx | ((v4si) fy & fz));
+      __sincosf_v4sf ((__Float32x4_t) fx, &s, &c);
+      fy = (v4sf) s;
+      memcpy (fout + i, &s, sizeof (s));
+      memcpy (fout2 + i, &c, sizeof (c));
+      if (reload)
+	__asm__ ("" ::: "memory");
+    }
+}
+
+INLINE_RUN (sincosf)
+
+INLINE_V2DF (exp, __exp_v2df) INLINE_V2DF (exp2, __exp2_v2df)
+INLINE_V2DF (exp10, __exp10_v2df) INLINE_V2DF (expm1, __expm1_v2df)
+INLINE_V2DF (log, __log_v2df) INLINE_V2DF (log2, __log2_v2df)
+INLINE_V2DF (log10, __log10_v2df) INLINE_V2DF (log1p, __log1p_v2df)
+INLINE_V2DF2 (pow, __pow_v2df) INLINE_V2DF (sin, __sin_v2df)
+INLINE_V2DF (cos, __cos_v2df) INLINE_V2DF (tan, __tan_v2df)
+INLINE_V2DF (atan, __atan_v2df) INLINE_V2DF2 (atan2, __atan2_v2df)
+INLINE_V2DF (asin, __asin_v2df) INLINE_V2DF (acos, __acos_v2df)
+INLINE_V2DF (sinh, __sinh_v2df) INLINE_V2DF (cosh, __cosh_v2df)
+INLINE_V2DF (tanh, __tanh_v2df)
+INLINE_V4SF (expf, __expf_v4sf) INLINE_V4SF (exp2f, __exp2f_v4sf)
+INLINE_V4SF (exp10f, __exp10f_v4sf) INLINE_V4SF (expm1f, __expm1f_v4sf)
+INLINE_V4SF (logf, __logf_v4sf) INLINE_V4SF (log2f, __log2f_v4sf)
+INLINE_V4SF (log10f, __log10f_v4sf) INLINE_V4SF (log1pf, __log1pf_v4sf)
+INLINE_V4SF2 (powf, __powf_v4sf) INLINE_V4SF (sinf, __sinf_v4sf)
+INLINE_V4SF (cosf, __cosf_v4sf) INLINE_V4SF (tanf, __tanf_v4sf)
+INLINE_V4SF (atanf, __atanf_v4sf) INLINE_V4SF2 (atan2f, __atan2f_v4sf)
+INLINE_V4SF (asinf, __asinf_v4sf) INLINE_V4SF (acosf, __acosf_v4sf)
+INLINE_V4SF (sinhf, __sinhf_v4sf) INLINE_V4SF (coshf, __coshf_v4sf)
+INLINE_V4SF (tanhf, __tanhf_v4sf)
+
+static const struct
+{
+  const char *name;
+  void (*run) (int);
+  void (*reload) (int);
+} inline_funcs[] = {
+# define I(name) { #name, inline_##name, reload_##name }
+  I (exp), I (exp2), I (exp10), I (expm1), I (log), I (log2), I (log10),
+  I (log1p), I (pow), I (sin), I (cos), I (sincos), I (tan), I (atan),
+  I (atan2), I (asin), I (acos), I (sinh), I (cosh), I (tanh),
+  I (expf), I (exp2f), I (exp10f), I (expm1f), I (logf), I (log2f),
+  I (log10f), I (log1pf), I (powf), I (sinf), I (cosf), I (sincosf),
+  I (tanf), I (atanf), I (atan2f), I (asinf), I (acosf), I (sinhf),
+  I (coshf), I (tanhf),
+# undef I
+};
+
+static void
+run_inline (const struct func *f, int latency)
+{
+  size_t i;
+
+  for (i = 0; i < sizeof (inline_funcs) / sizeof (inline_funcs[0]); i++)
+    if (strcmp (inline_funcs[i].name, f->name) == 0)
+      {
+	inline_funcs[i].run (latency);
+	return;
+      }
+}
+
+static void
+run_reload (const struct func *f, int latency)
+{
+  size_t i;
+
+  for (i = 0; i < sizeof (inline_funcs) / sizeof (inline_funcs[0]); i++)
+    if (strcmp (inline_funcs[i].name, f->name) == 0)
+      {
+	inline_funcs[i].reload (latency);
+	return;
+      }
+}
+#endif
+
+/* Nanoseconds per element of RUN, the minimum over five timings of
+   at least min_time / 5 seconds each.  */
+static double
+measure (void (*run) (const struct func *, int), const struct func *f,
+	 int latency)
+{
+  double best = INFINITY;
+  long iters = 1;
+  int rep;
+
+  for (;;)
+    {
+      double t = now ();
+      long k;
+
+      for (k = 0; k < iters; k++)
+	run (f, latency);
+      t = now () - t;
+      if (t >= min_time / 5)
+	break;
+      iters *= 2;
+    }
+  for (rep = 0; rep < 5; rep++)
+    {
+      double t = now ();
+      long k;
+
+      for (k = 0; k < iters; k++)
+	run (f, latency);
+      t = (now () - t) / iters / N * 1e9;
+      if (t < best)
+	best = t;
+    }
+  return best;
+}
+
+static int
+selected (const char *name, int argc, char **argv, int first)
+{
+  int i;
+
+  if (first == argc)
+    return 1;
+  for (i = first; i < argc; i++)
+    if (strcmp (argv[i], name) == 0)
+      return 1;
+  return 0;
+}
+
+int
+main (int argc, char **argv)
+{
+  size_t i;
+  int first = 1, d;
+
+  if (argc > 2 && strcmp (argv[1], "-t") == 0)
+    {
+      min_time = atof (argv[2]);
+      first = 3;
+    }
+
+  printf ("function,impl,distribution,metric,ns_per_element\n");
+  for (i = 0; i < sizeof (funcs) / sizeof (funcs[0]); i++)
+    {
+      const struct func *f = &funcs[i];
+
+      if (!selected (f->name, argc, argv, first))
+	continue;
+      for (d = 0; d < NDIST; d++)
+	{
+	  if (!(f->dists & (1 << d)))
+	    continue;
+	  fill (f, d);
+	  printf ("%s,vector,%s,throughput,%.3f\n", f->name, dist_names[d],
+		  measure (run_vector, f, 0));
+	  printf ("%s,vector,%s,latency,%.3f\n", f->name, dist_names[d],
+		  measure (run_vector, f, 1));
+	  printf ("%s,array,%s,throughput,%.3f\n", f->name, dist_names[d],
+		  measure (run_array, f, 0));
+#ifdef LIBMVEC_BENCH_INLINE
+	  printf ("%s,inline,%s,throughput,%.3f\n", f->name, dist_names[d],
+		  measure (run_inline, f, 0));
+	  printf ("%s,inline,%s,latency,%.3f\n", f->name, dist_names[d],
+		  measure (run_inline, f, 1));
+	  printf ("%s,reload,%s,throughput,%.3f\n", f->name, dist_names[d],
+		  measure (run_reload, f, 0));
+	  printf ("%s,reload,%s,latency,%.3f\n", f->name, dist_names[d],
+		  measure (run_reload, f, 1));
+#endif
+	  printf ("%s,scalar,%s,throughput,%.3f\n", f->name, dist_names[d],
+		  measure (run_scalar, f, 0));
+	  printf ("%s,scalar,%s,latency,%.3f\n", f->name, dist_names[d],
+		  measure (run_scalar, f, 1));
+	  fflush (stdout);
+	}
+    }
+  return 0;
+}
@@ -0,0 +1,76 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* Array entry points.  Each function computes OUT[i] = f (IN[i]) (or
+   f (IN[i], IN2[i])) for 0 <= i < N with the vector kernels.  OUT may
+   be the same array as an input but must not partially overlap it.
+   mvec_sincos and mvec_sincosf store sin to OUT and cos to OUT2.  */
+
+#ifndef _LIBMVEC_ARRAY_H
+#define _LIBMVEC_ARRAY_H
+
+#include <stddef.h>
+
+extern void mvec_exp (const double *in, double *out, size_t n);
+extern void mvec_exp2 (const double *in, double *out, size_t n);
+extern void mvec_exp10 (const double *in, double *out, size_t n);
+extern void mvec_expm1 (const double *in, double *out, size_t n);
+extern void mvec_log (const double *in, double *out, size_t n);
+extern void mvec_log2 (const double *in, double *out, size_t n);
+extern void mvec_log10 (const double *in, double *out, size_t n);
+extern void mvec_log1p (const double *in, double *out, size_t n);
+extern void mvec_pow (const double *in, const double *in2, double *out,
+		      size_t n);
+extern void mvec_sin (const double *in, double *out, size_t n);
+extern void mvec_cos (const double *in, double *out, size_t n);
+extern void mvec_sincos (const double *in, double *out, double *out2,
+			 size_t n);
+extern void mvec_tan (const double *in, double *out, size_t n);
+extern void mvec_atan (const double *in, double *out, size_t n);
+extern void mvec_atan2 (const double *in, const double *in2, double *out,
+			size_t n);
+extern void mvec_asin (const double *in, double *out, size_t n);
+extern void mvec_acos (const double *in, double *out, size_t n);
+extern void mvec_sinh (const double *in, double *out, size_t n);
+extern void mvec_cosh (const double *in, double *out, size_t n);
+extern void mvec_tanh (const double *in, double *out, size_t n);
+
+extern void mvec_expf (const float *in, float *out, size_t n);
+extern void mvec_exp2f (const float *in, float *out, size_t n);
+extern void mvec_exp10f (const float *in, float *out, size_t n);
+extern void mvec_expm1f (const float *in, float *out, size_t n);
+extern void mvec_logf (const float *in, float *out, size_t n);
+extern void mvec_log2f (const float *in, float *out, size_t n);
+extern void mvec_log10f (const float *in, float *out, size_t n);
+extern void mvec_log1pf (const float *in, float *out, size_t n);
+extern void mvec_powf (const float *in, const float *in2, float *out,
+		       size_t n);
+extern void mvec_sinf (const float *in, float *out, size_t n);
+extern void mvec_cosf (const float *in, float *out, size_t n);
+extern void mvec_sincosf (const float *in, float *out, float *out2,
+			  size_t n);
+extern void mvec_tanf (const float *in, float *out, size_t n);
+extern void mvec_atanf (const float *in, float *out, size_t n);
+extern void mvec_atan2f (const float *in, const float *in2, float *out,
+			 size_t n);
+extern void mvec_asinf (const float *in, float *out, size_t n);
+extern void mvec_acosf (const float *in, float *out, size_t n);
+extern void mvec_sinhf (const float *in, float *out, size_t n);
+extern void mvec_coshf (const float *in, float *out, size_t n);
+extern void mvec_tanhf (const float *in, float *out, size_t n);
+
+#endif
@@ -0,0 +1,90 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _LIBMVEC_DOUBLE_DATA_H
+#define _LIBMVEC_DOUBLE_DATA_H
+
+#include "math_config.h"
+
+//
+// The scalar constants of the glibc double precision tables, each
+// replicated across a vector.  The kernels load them two at a time
+// with ldp instead of loading and duplicating them one by one on every
+// call.  They are defined in the libmvec_*_data.c file that includes
+// the table, the only place where its initializer is visible, so both
+// always hold the same values.
+//
+
+extern const struct exp_v2df_data
+{
+  __Float64x2_t invln2N;
+  __Float64x2_t shift;
+  __Float64x2_t negln2hiN;
+  __Float64x2_t negln2loN;
+  __Float64x2_t poly[EXP_POLY_ORDER - 1];
+  __Float64x2_t exp2_shift;
+  __Float64x2_t exp2_poly[EXP2_POLY_ORDER];
+} __exp_v2df_data attribute_hidden;
+
+extern const struct log_v2df_data
+{
+  __Float64x2_t ln2hi;
+  __Float64x2_t ln2lo;
+  __Float64x2_t poly[LOG_POLY_ORDER - 1];
+  __Float64x2_t poly1[LOG_POLY1_ORDER - 1];
+} __log_v2df_data attribute_hidden;
+
+extern const struct log2_v2df_data
+{
+  __Float64x2_t invln2hi;
+  __Float64x2_t invln2lo;
+  __Float64x2_t poly[LOG2_POLY_ORDER - 1];
+  __Float64x2_t poly1[LOG2_POLY1_ORDER - 1];
+} __log2_v2df_data attribute_hidden;
+
+extern const struct pow_log_v2df_data
+{
+  __Float64x2_t ln2hi;
+  __Float64x2_t ln2lo;
+  __Float64x2_t poly[POW_LOG_POLY_ORDER - 1];
+} __pow_log_v2df_data attribute_hidden;
+
+//
+// Coefficients of single kernels that do not come from a glibc table,
+// defined in libmvec_poly_data.c.
+//
+
+extern const struct sin_v2df_data
+{
+  __Float64x2_t sin_poly[5];
+  __Float64x2_t cos_poly[5];
+} __sin_v2df_data attribute_hidden;
+
+extern const __Float64x2_t __asin_poly[13] attribute_hidden;
+extern const __Float64x2_t __atan_poly[12] attribute_hidden;
+extern const __Float64x2_t __exp10_consts[4] attribute_hidden;
+extern const __Float64x2_t __log10_invln10[2] attribute_hidden;
+
+#ifdef LIBMVEC_LOW_ACCURACY
+extern const __Float64x2_t __exp_poly_low[3] attribute_hidden;
+extern const __Float64x2_t __exp2_poly_low[4] attribute_hidden;
+extern const __Float64x2_t __log_poly_low[4] attribute_hidden;
+extern const __Float64x2_t __log_near_one_poly_low[8] attribute_hidden;
+extern const __Float64x2_t __log2_poly_low[5] attribute_hidden;
+extern const __Float64x2_t __log2_near_one_poly_low[8] attribute_hidden;
+#endif
+
+#endif
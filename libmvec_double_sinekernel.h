@@ -0,0 +1,269 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Argument reduction and table evaluation shared by the double vlen2
+   sin, cos, sincos and tan kernels and by the float vlen4 tanf kernel.
+   Include after libmvec_double_sinetable.h, libmvec_util.h and
+   libmvec_double_data.h.  */
+
+#ifndef _LIBMVEC_DOUBLE_SINEKERNEL_H
+#define _LIBMVEC_DOUBLE_SINEKERNEL_H
+
+#define CUTOFF 1000.00
+
+//
+// argument reduction for |x| > CUTOFF
+//
+
+/* 48 bits of _inv_modulus_bits starting at bit T, as an integer.  */
+static inline __Float64x2_t _inv_modulus_chunk(__Uint64x2_t t)
+{
+  const uint32_t *bits = _inv_modulus_bits;
+  __Uint64x2_t w, s, b0, b1, b2, v;
+
+  w = t >> 5;
+  s = t & 31;
+  b0 = (__Uint64x2_t) { bits[w[0]], bits[w[1]] };
+  b1 = (__Uint64x2_t) { bits[w[0] + 1], bits[w[1] + 1] };
+  b2 = (__Uint64x2_t) { bits[w[0] + 2], bits[w[1] + 2] };
+  v = (((b0 << 32) | b1) << s) | (b2 >> (32 - s));
+  v = v >> 16;
+  return (__Float64x2_t) { (double) v[0], (double) v[1] };
+}
+
+/* s + *t == a + b exactly.  */
+static inline __Float64x2_t _two_sum(__Float64x2_t a, __Float64x2_t b,
+				     __Float64x2_t *t)
+{
+  __Float64x2_t s, bb;
+
+  s = a + b;
+  bb = s - a;
+  *t = (a - (s - bb)) + (b - bb);
+  return s;
+}
+
+/* Payne-Hanek reduction of a = |x| for CUTOFF < a < inf.  With
+   a = m*2^q, m in [1,2), the bits of 2^q*16/PI of weight 2^57 and
+   above only add multiples of 32 to a*16/PI since m*2^52 is an
+   integer.  The next 192 bits are read from _inv_modulus_bits as four
+   48-bit chunks d0-d3, so that a*16/PI = m*(d0+d1+d2+d3) mod 32.
+   Returns k mod 32 and sets a - k*(2*PI/32) = *x0 + *r1.  */
+__AARCH64_VECTOR_PCS_ATTR
+static inline __Float64x2_t _sine_reduce_large(__Float64x2_t a,
+					       __Float64x2_t *x0,
+					       __Float64x2_t *r1)
+{
+  __Float64x2_t *modulus;
+  __Float64x2_t m, d0, d1, d2, d3, p0, p1, p2, p3, e0, e1, e2;
+  __Float64x2_t h, k, lo, l1, l2, l3, l4, l5, l6, fh, fl;
+  __Uint64x2_t ia, t;
+
+  ia = (__Uint64x2_t) a;
+  m = (__Float64x2_t) ((ia & 0xfffffffffffffULL) | (0x3ffULL << 52));
+  t = (ia >> 52) - 0x3ff + 10;
+  d0 = _inv_modulus_chunk (t) * 0x1p9;
+  d1 = _inv_modulus_chunk (t + 48) * 0x1p-39;
+  d2 = _inv_modulus_chunk (t + 96) * 0x1p-87;
+  d3 = _inv_modulus_chunk (t + 144) * 0x1p-135;
+
+  /* The products with d0-d2 are split exactly into p + e, the integer
+     parts of p0 and p1 are reduced mod 32 exactly.  */
+  p0 = m * d0;
+  e0 = __builtin_aarch64_fmav2df (m, d0, -p0);
+  p1 = m * d1;
+  e1 = __builtin_aarch64_fmav2df (m, d1, -p1);
+  p2 = m * d2;
+  e2 = __builtin_aarch64_fmav2df (m, d2, -p2);
+  p3 = m * d3;
+  p0 = p0 - 32.0 * __builtin_aarch64_roundv2df (p0 * 0x1p-5);
+  p1 = p1 - 32.0 * __builtin_aarch64_roundv2df (p1 * 0x1p-5);
+
+  /* Sum the terms in decreasing order of magnitude with the integer
+     part k taken out as soon as it is known, so that the fraction
+     keeps its accuracy when it is tiny.  */
+  h = _two_sum (p0, p1, &l1);
+  h = _two_sum (h, e0, &l2);
+  k = __builtin_aarch64_roundv2df (h);
+  h = h - k;
+  h = _two_sum (h, l1, &l3);
+  h = _two_sum (h, l2, &l4);
+  h = _two_sum (h, p2, &l5);
+  h = _two_sum (h, e1, &l6);
+  lo = l3 + l4 + l5 + l6 + e2 + p3;
+  fh = _two_sum (h, lo, &fl);
+
+  /* Scale the fraction by 2*PI/32.  */
+  modulus = (__Float64x2_t *)_modulus;
+  *x0 = fh * modulus[0];
+  *r1 = __builtin_aarch64_fmav2df (fh, modulus[0], -*x0)
+	+ fh * modulus[1] + fl * modulus[0];
+  return k - 32.0 * __builtin_aarch64_floorv2df (k * 0x1p-5);
+}
+
+//
+// argument reduction, shared by sin, cos, sincos and tan
+//
+
+/* Reduce a = |x| to a - k*(2*PI/32) = *x0 + *r1 and return k.  Only
+   k mod 32 is meaningful for large a.  */
+__AARCH64_VECTOR_PCS_ATTR
+static inline __Float64x2_t _sine_reduce(__Float64x2_t a, __Float64x2_t *x0p,
+					 __Float64x2_t *r1p)
+{
+  __Float64x2_t *vmod_ptr, vmod;
+  __Float64x2_t *modulus;
+  __Float64x2_t m0,m1,m2;
+  __Float64x2_t t0, t1, a0, a1, a2, x0, x1, r1, k;
+  __Float64x2_t kl, x0l, r1l;
+  __Uint64x2_t large;
+
+  vmod_ptr = (__Float64x2_t *)_vmod;
+  vmod = *vmod_ptr;
+  modulus = (__Float64x2_t *)_modulus; 
+
+  m0 = modulus[0];
+  m1 = modulus[1];
+  m2 = modulus[2];
+
+  a1 = a * vmod;  /* vmod is 1/(2*PI/32) */
+  k = __builtin_aarch64_roundv2df (a1);
+  t0 = k * m0;
+  /* We need to explicitly use fma for the extra precision. */
+  t1 = __builtin_aarch64_fmav2df (k, m0, -t0);
+  a1 = k * m1;
+  /* We need to explicitly use fma for the extra precision. */
+  a2 =  __builtin_aarch64_fmav2df (k, m1, -a1);
+  a0 = a - t0;
+  a1 = a1 + t1; /* add remainder from 1st term to 2nd term */
+  x0 = a0 - a1;
+  x1 = a0 - x0;
+  x1 = x1 - a1;
+  r1 = x1 - a2;
+  r1 = r1 - k * m2;
+
+  /* Lanes above CUTOFF are reduced again by _sine_reduce_large, the
+     others feed it a harmless 2^10.  */
+  large = (__Uint64x2_t) (a > CUTOFF);
+  if (__glibc_unlikely (any_lane_v2di (large)))
+    {
+      kl = _sine_reduce_large (select_v2df (large, a, (__Float64x2_t) { 0x1p10, 0x1p10 }),
+			       &x0l, &r1l);
+      k = select_v2df (large, kl, k);
+      x0 = select_v2df (large, x0l, x0);
+      r1 = select_v2df (large, r1l, r1);
+    }
+  *x0p = x0;
+  *r1p = r1;
+  return k;
+}
+
+//
+// table and polynomial evaluation for a reduced argument
+//
+
+/* tablebase_0 and tablebase_1 index the table entries of the two lanes,
+   already scaled and wrapped to 0 - 0x7c.  */
+__AARCH64_VECTOR_PCS_ATTR
+static inline __Float64x2_t _sine_eval(__Float64x2_t x0, __Float64x2_t r1,
+				       double *tbl, unsigned int tablebase_0,
+				       unsigned int tablebase_1)
+{
+  __Float64x2_t result;
+  __Float64x2_t t0, t1, x1, x02, c0;
+  __Float64x2_t hiref, loref, tbl2, tbl3;
+  __Float64x2_t sinpoly_0, sinpoly_1, sinpoly_2, sinpoly_3, sinpoly_4;
+  __Float64x2_t cospoly_0, cospoly_1, cospoly_2, cospoly_3, cospoly_4;
+  const __Float64x2_t *sinpoly, *cospoly;
+
+  sinpoly = __sin_v2df_data.sin_poly;
+  cospoly = __sin_v2df_data.cos_poly;
+  sinpoly_0 = sinpoly[0];
+  sinpoly_1 = sinpoly[1];
+  sinpoly_2 = sinpoly[2];
+  sinpoly_3 = sinpoly[3];
+  sinpoly_4 = sinpoly[4];
+  cospoly_0 = cospoly[0];
+  cospoly_1 = cospoly[1];
+  cospoly_2 = cospoly[2];
+  cospoly_3 = cospoly[3];
+  cospoly_4 = cospoly[4];
+
+  /* Each entry is hiref, loref, sin and cos of the reference point,
+     loaded as two pairs per lane.  */
+  lookup_pair_v2df (&tbl[tablebase_0], &tbl[tablebase_1], &hiref, &loref);
+  lookup_pair_v2df (&tbl[tablebase_0 + 2], &tbl[tablebase_1 + 2],
+		    &tbl2, &tbl3);
+  c0 = x0 - hiref;
+  x1 = x0 - c0;
+  x1 = x1 - hiref;
+  x0 = c0;
+  x1 = x1 + r1;
+  x1 = x1 - loref;
+  x02 = x0 * x0; /* reduced x^2 for poly */
+  t0 = x02 * sinpoly_4 + sinpoly_3;
+  t0 = x02 * t0 + sinpoly_2;
+  t0 = x02 * t0 + sinpoly_1;
+  t0 = x02 * t0 + sinpoly_0;
+  t0 = t0 * x02;
+  t0 = x0 * t0 + x1;
+  t0 = t0 + x0;
+  t0 = t0 * tbl3;                         /* cos of ref, gives cos(a)*sin(b) */
+  t1 = x02 * cospoly_4 + cospoly_3;
+  t1 = x02 * t1 + cospoly_2;
+  t1 = x02 * t1 + cospoly_1;
+  t1 = x02 * t1 + cospoly_0;
+  t1 = x02 * t1;
+  t1 = t1 * tbl2;                         /* sin of ref */
+  result = t1 + t0;
+  result = result + tbl2;                 /* add sine */
+  return(result);
+}
+
+//
+// tangent of a finite argument
+//
+
+/* tan = sin / cos from a single reduction.  The cosine entries are
+   taken about their own reference points, so cos keeps its relative
+   accuracy near its zeros and the quotient stays accurate close to the
+   poles.  */
+__AARCH64_VECTOR_PCS_ATTR
+static inline __Float64x2_t _tan_kernel(__Float64x2_t x)
+{
+  __Float64x2_t s, c, a, x0, r1, k;
+  unsigned int tablebase_0, tablebase_1, sinbase_0, sinbase_1;
+
+  a = __builtin_aarch64_absv2df (x);
+  k = _sine_reduce (a, &x0, &r1);
+  tablebase_0 = (unsigned int) k[0];
+  tablebase_1 = (unsigned int) k[1];
+  sinbase_0 = tablebase_0;
+  sinbase_1 = tablebase_1;
+  if (!(x[0] > 0))
+    sinbase_0 += 1<<4;
+  if (!(x[1] > 0))
+    sinbase_1 += 1<<4;
+
+  s = _sine_eval (x0, r1, (double *)_sin_table,
+		  (sinbase_0 << 2) & 0x7c, (sinbase_1 << 2) & 0x7c);
+  c = _sine_eval (x0, r1, (double *)_cos_table,
+		  (tablebase_0 << 2) & 0x7c, (tablebase_1 << 2) & 0x7c);
+  /* _sine_eval returns +0 for sin(-0).  */
+  return select_v2df ((__Uint64x2_t) (x == 0), x, s / c);
+}
+
+#endif
@@ -21,6 +21,9 @@
 // is 4 doubles, thus the total table is 32 entries 0 - 2*PI!
 //
 
+#ifndef _LIBMVEC_DOUBLE_SINETABLE_H
+#define _LIBMVEC_DOUBLE_SINETABLE_H
+
 #ifdef BIG_ENDI
 #define ENDIANPAIR(h,l) h,l
 #else
@@ -223,6 +226,25 @@ static const __attribute__ ((aligned(64))) uint32_t _vmod[] = {
 	ENDIANPAIR(0x40145F30, 0x6DC9C883)  /* 5.0929581789406507445 */
 };
 
+// Bits of 16/PI = 1/(2*PI/32) for the large argument reduction, most
+// significant first.  Word 2 starts at the 2^2 bit, the two leading
+// zero words let the reduction read above the top bit.  These are the
+// bits of 2/PI, shifted by three places.
+static const __attribute__ ((aligned(64))) uint32_t _inv_modulus_bits[] = {
+	0x00000000, 0x00000000, 0xA2F9836E, 0x4E441529,
+	0xFC2757D1, 0xF534DDC0, 0xDB629599, 0x3C439041,
+	0xFE5163AB, 0xDEBBC561, 0xB7246E3A, 0x424DD2E0,
+	0x06492EEA, 0x09D1921C, 0xFE1DEB1C, 0xB129A73E,
+	0xE88235F5, 0x2EBB4484, 0xE99C7026, 0xB45F7E41,
+	0x3991D639, 0x835339F4, 0x9C845F8B, 0xBDF9283B,
+	0x1FF897FF, 0xDE05980F, 0xEF2F118B, 0x5A0A6D1F,
+	0x6D367ECF, 0x27CB09B7, 0x4F463F66, 0x9E5FEA2D,
+	0x7527BAC7, 0xEBE5F17B, 0x3D0739F7, 0x8A5292EA,
+	0x6BFB5FB1, 0x1F8D5D08, 0x56033046, 0xFC7B6BAB
+};
+
 // Cosine table is one-quarter phase beyond sine table:
 // _cos_table	=	_sin_table + (_sin_table_end-_sin_table)/4
 static const uint32_t *_cos_table = &_sin_table[64];
+
+#endif
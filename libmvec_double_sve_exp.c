@@ -0,0 +1,82 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* Based on exp.c from https://github.com/ARM-software/optimized-routines */
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "libmvec_sve_util.h"
+
+#define N (1 << EXP_TABLE_BITS)
+#define InvLn2N __exp_data.invln2N
+#define NegLn2hiN __exp_data.negln2hiN
+#define NegLn2loN __exp_data.negln2loN
+#define T __exp_data.tab
+#define C2 __exp_data.poly[5 - EXP_POLY_ORDER]
+#define C3 __exp_data.poly[6 - EXP_POLY_ORDER]
+#define C4 __exp_data.poly[7 - EXP_POLY_ORDER]
+#define C5 __exp_data.poly[8 - EXP_POLY_ORDER]
+
+/* Same bounds as in _ZGVnN2v_exp.  */
+#define BOUND 1024.0
+#define SPECIAL_BOUND 512.0
+
+svfloat64_t
+_ZGVsMxv_exp(svfloat64_t x, svbool_t pg)
+{
+  svfloat64_t z, kd, r, r2, tail, scale, tmp, y;
+  svuint64_t ki, idx, sbits;
+  svbool_t special;
+
+  MVEC_STATS_VECTOR (EXP);
+
+  /* FMIN and FMAX propagate nan, inf lanes end up as +-BOUND which
+     give inf and 0.  */
+  x = svmin_n_f64_x (pg, x, BOUND);
+  x = svmax_n_f64_x (pg, x, -BOUND);
+  special = svacgt_n_f64 (pg, x, SPECIAL_BOUND);
+  MVEC_STATS_LANES (EXP, RANGE, sve_count_lanes_f64 (pg, special));
+
+  z = svmul_n_f64_x (pg, x, InvLn2N);
+  kd = svrinta_f64_x (pg, z);
+  ki = svreinterpret_u64_s64 (svcvt_s64_f64_x (pg, kd));
+
+  idx = svlsl_n_u64_x (pg, svand_n_u64_x (pg, ki, N - 1), 1);
+  sbits = svld1_gather_u64index_u64 (pg, T + 1, idx);
+  sbits = svadd_u64_x (pg, sbits,
+		       svlsl_n_u64_x (pg, ki, 52 - EXP_TABLE_BITS));
+  scale = svreinterpret_f64_u64 (sbits);
+  tail = svreinterpret_f64_u64 (svld1_gather_u64index_u64 (pg, T, idx));
+
+  r = svmla_n_f64_x (pg, x, kd, NegLn2hiN);
+  r = svmla_n_f64_x (pg, r, kd, NegLn2loN);
+  r2 = svmul_f64_x (pg, r, r);
+  tmp = svmla_f64_x (pg, svdup_n_f64 (C4), r, svdup_n_f64 (C5));
+  tmp = svmul_f64_x (pg, svmul_f64_x (pg, r2, r2), tmp);
+  tmp = svmla_f64_x (pg, tmp, r2,
+		     svmla_f64_x (pg, svdup_n_f64 (C2), r, svdup_n_f64 (C3)));
+  tmp = svadd_f64_x (pg, svadd_f64_x (pg, tail, r), tmp);
+  y = svmla_f64_x (pg, scale, scale, tmp);
+  if (__glibc_unlikely (svptest_any (pg, special)))
+    y = svsel_f64 (special,
+		   sve_exp_specialcase (pg, tmp, sbits,
+					svcmpgt_n_f64 (pg, x, 0.0)),
+		   y);
+  return y;
+}
+weak_alias (_ZGVsMxv_exp, _ZGVsMxv___exp_finite)
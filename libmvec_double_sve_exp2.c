@@ -0,0 +1,80 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* Based on exp2.c from https://github.com/ARM-software/optimized-routines */
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "libmvec_sve_util.h"
+
+#define N (1 << EXP_TABLE_BITS)
+#define Shift __exp_data.exp2_shift
+#define T __exp_data.tab
+#define C1 __exp_data.exp2_poly[0]
+#define C2 __exp_data.exp2_poly[1]
+#define C3 __exp_data.exp2_poly[2]
+#define C4 __exp_data.exp2_poly[3]
+#define C5 __exp_data.exp2_poly[4]
+
+/* Same bounds as in _ZGVnN2v_exp2.  */
+#define HI_BOUND 1024.0
+#define LO_BOUND -1075.0
+#define SPECIAL_BOUND 512.0
+
+svfloat64_t
+_ZGVsMxv_exp2(svfloat64_t x, svbool_t pg)
+{
+  svfloat64_t kd, r, r2, tail, scale, tmp, y;
+  svuint64_t ki, idx, sbits;
+  svbool_t special;
+
+  MVEC_STATS_VECTOR (EXP2);
+
+  x = svmin_n_f64_x (pg, x, HI_BOUND);
+  x = svmax_n_f64_x (pg, x, LO_BOUND);
+  special = svacgt_n_f64 (pg, x, SPECIAL_BOUND);
+  MVEC_STATS_LANES (EXP2, RANGE, sve_count_lanes_f64 (pg, special));
+
+  /* x = k/N + r with r in [-1/(2N), 1/(2N)] and int k.  */
+  kd = svadd_n_f64_x (pg, x, Shift);
+  ki = svreinterpret_u64_f64 (kd);
+  kd = svsub_n_f64_x (pg, kd, Shift);
+  r = svsub_f64_x (pg, x, kd);
+
+  idx = svlsl_n_u64_x (pg, svand_n_u64_x (pg, ki, N - 1), 1);
+  sbits = svld1_gather_u64index_u64 (pg, T + 1, idx);
+  sbits = svadd_u64_x (pg, sbits,
+		       svlsl_n_u64_x (pg, ki, 52 - EXP_TABLE_BITS));
+  scale = svreinterpret_f64_u64 (sbits);
+  tail = svreinterpret_f64_u64 (svld1_gather_u64index_u64 (pg, T, idx));
+
+  r2 = svmul_f64_x (pg, r, r);
+  tmp = svmla_f64_x (pg, svdup_n_f64 (C4), r, svdup_n_f64 (C5));
+  tmp = svmul_f64_x (pg, svmul_f64_x (pg, r2, r2), tmp);
+  tmp = svmla_f64_x (pg, tmp, r2,
+		     svmla_f64_x (pg, svdup_n_f64 (C2), r, svdup_n_f64 (C3)));
+  tmp = svadd_f64_x (pg, svmla_n_f64_x (pg, tail, r, C1), tmp);
+  y = svmla_f64_x (pg, scale, scale, tmp);
+  if (__glibc_unlikely (svptest_any (pg, special)))
+    y = svsel_f64 (special,
+		   sve_exp_specialcase (pg, tmp, sbits,
+					svcmpgt_n_f64 (pg, x, 0.0)),
+		   y);
+  return y;
+}
+weak_alias (_ZGVsMxv_exp2, _ZGVsMxv___exp2_finite)
@@ -0,0 +1,146 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* Based on log.c from https://github.com/ARM-software/optimized-routines */
+
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "libmvec_sve_util.h"
+
+#define T __log_data.tab
+#define B __log_data.poly1
+#define A __log_data.poly
+#define Ln2hi __log_data.ln2hi
+#define Ln2lo __log_data.ln2lo
+#define N (1 << LOG_TABLE_BITS)
+#define OFF 0x3fe6000000000000
+/* Distance between two table entries in doubles.  */
+#define STRIDE (sizeof (T[0]) / sizeof (double))
+
+/* Inputs in [LO, HI) are handled by __sve_log_near_one.  */
+#define LO asuint64 (1.0 - 0x1p-4)
+#define HI asuint64 (1.0 + 0x1.09p-4)
+
+/* log(x) for x close to 1.0, as __log_near_one in
+   libmvec_double_vlen2_log.h.  */
+static __always_inline svfloat64_t
+__sve_log_near_one(svbool_t pg, svfloat64_t x)
+{
+  svfloat64_t r, r2, r3, y, p, w, rhi, rlo, hi, lo;
+
+  r = svsub_n_f64_x (pg, x, 1.0);
+  r2 = svmul_f64_x (pg, r, r);
+  r3 = svmul_f64_x (pg, r, r2);
+  p = svmla_n_f64_x (pg, svdup_n_f64 (B[7]), r, B[8]);
+  p = svmla_n_f64_x (pg, p, r2, B[9]);
+  p = svmla_n_f64_x (pg, p, r3, B[10]);
+  y = svmla_n_f64_x (pg, svdup_n_f64 (B[4]), r, B[5]);
+  y = svmla_n_f64_x (pg, y, r2, B[6]);
+  p = svmla_f64_x (pg, y, r3, p);
+  y = svmla_n_f64_x (pg, svdup_n_f64 (B[1]), r, B[2]);
+  y = svmla_n_f64_x (pg, y, r2, B[3]);
+  y = svmul_f64_x (pg, r3, svmla_f64_x (pg, y, r3, p));
+  /* Worst-case error is around 0.507 ULP.  */
+  w = svmul_n_f64_x (pg, r, 0x1p27);
+  rhi = svsub_f64_x (pg, svadd_f64_x (pg, r, w), w);
+  rlo = svsub_f64_x (pg, r, rhi);
+  w = svmul_n_f64_x (pg, svmul_f64_x (pg, rhi, rhi), B[0]); /* B[0] == -0.5.  */
+  hi = svadd_f64_x (pg, r, w);
+  lo = svadd_f64_x (pg, svsub_f64_x (pg, r, hi), w);
+  lo = svmla_f64_x (pg, lo, svmul_n_f64_x (pg, rlo, B[0]),
+		    svadd_f64_x (pg, rhi, r));
+  y = svadd_f64_x (pg, y, lo);
+  return svadd_f64_x (pg, y, hi);
+}
+
+/* Results for the lanes that are not positive normal numbers, as
+   __log_special in libmvec_double_vlen2_log.h.  */
+static __always_inline svfloat64_t
+__sve_log_special(svbool_t pg, svfloat64_t x, svfloat64_t y)
+{
+  svfloat64_t e;
+  svbool_t fix;
+
+  fix = svnot_b_z (pg, svand_b_z (pg, svcmpgt_n_f64 (pg, x, 0.0),
+				  svcmple_n_f64 (pg, x, DBL_MAX)));
+  e = svsel_f64 (svcmpeq_n_f64 (pg, x, 0.0), svdup_n_f64 (-INFINITY),
+		 svadd_f64_x (pg, x, x));
+  e = svsel_f64 (svcmplt_n_f64 (pg, x, 0.0), svdup_n_f64 (NAN), e);
+  return svsel_f64 (fix, e, y);
+}
+
+svfloat64_t
+_ZGVsMxv_log(svfloat64_t x, svbool_t pg)
+{
+  svfloat64_t xn, z, r, r2, kd, invc, logc, w, hi, lo, p, y;
+  svuint64_t ix, tmp, i;
+  svbool_t special, sub, near1;
+
+  MVEC_STATS_VECTOR (LOG);
+
+  /* Zero, negative, subnormal, inf and nan lanes.  Subnormal inputs
+     are normalized in the vector, the rest get their result from
+     __sve_log_special at the end.  */
+  special = svnot_b_z (pg, svand_b_z (pg, svcmpge_n_f64 (pg, x, DBL_MIN),
+				      svcmple_n_f64 (pg, x, DBL_MAX)));
+  MVEC_STATS_LANES (LOG, SPECIAL, sve_count_lanes_f64 (pg, special));
+  ix = svreinterpret_u64_f64 (x);
+  if (__glibc_unlikely (svptest_any (pg, special)))
+    {
+      sub = svand_b_z (pg, svcmpgt_n_f64 (pg, x, 0.0),
+		       svcmplt_n_f64 (pg, x, DBL_MIN));
+      xn = svmul_n_f64_m (sub, x, 0x1p52);
+      ix = svsub_n_u64_m (sub, svreinterpret_u64_f64 (xn), 52ULL << 52);
+    }
+
+  tmp = svsub_n_u64_x (pg, ix, OFF);
+  i = svand_n_u64_x (pg, svlsr_n_u64_x (pg, tmp, 52 - LOG_TABLE_BITS),
+		     N - 1);
+  i = svmul_n_u64_x (pg, i, STRIDE);
+  kd = svcvt_f64_s64_x (pg, svasr_n_s64_x (pg, svreinterpret_s64_u64 (tmp),
+					    52));
+  z = svreinterpret_f64_u64 (svsub_u64_x (pg, ix,
+					  svand_n_u64_x (pg, tmp,
+							 0xfffULL << 52)));
+  invc = svld1_gather_u64index_f64 (pg, &T[0].invc, i);
+  logc = svld1_gather_u64index_f64 (pg, &T[0].logc, i);
+
+  r = svmad_n_f64_x (pg, z, invc, -1.0);
+  w = svmla_n_f64_x (pg, logc, kd, Ln2hi);
+  hi = svadd_f64_x (pg, w, r);
+  lo = svadd_f64_x (pg, svsub_f64_x (pg, w, hi), r);
+  lo = svmla_n_f64_x (pg, lo, kd, Ln2lo);
+  r2 = svmul_f64_x (pg, r, r);
+  p = svmla_n_f64_x (pg, svdup_n_f64 (A[3]), r, A[4]);
+  p = svmla_f64_x (pg, svmla_n_f64_x (pg, svdup_n_f64 (A[1]), r, A[2]),
+		   r2, p);
+  y = svmla_n_f64_x (pg, lo, r2, A[0]);
+  y = svmla_f64_x (pg, y, svmul_f64_x (pg, r, r2), p);
+  y = svadd_f64_x (pg, y, hi);
+
+  near1 = svcmplt_n_u64 (pg, svsub_n_u64_x (pg, svreinterpret_u64_f64 (x),
+					    LO), HI - LO);
+  MVEC_STATS_LANES (LOG, NEAR_ONE, sve_count_lanes_f64 (pg, near1));
+  if (svptest_any (pg, near1))
+    y = svsel_f64 (near1, __sve_log_near_one (pg, x), y);
+  if (__glibc_unlikely (svptest_any (pg, special)))
+    return __sve_log_special (pg, x, y);
+  return y;
+}
+weak_alias (_ZGVsMxv_log, _ZGVsMxv___log_finite)
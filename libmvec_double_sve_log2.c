@@ -0,0 +1,139 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* Based on log2.c from https://github.com/ARM-software/optimized-routines */
+
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "libmvec_sve_util.h"
+
+#define T __log2_data.tab
+#define B __log2_data.poly1
+#define A __log2_data.poly
+#define InvLn2hi __log2_data.invln2hi
+#define InvLn2lo __log2_data.invln2lo
+#define N (1 << LOG2_TABLE_BITS)
+#define OFF 0x3fe6000000000000
+/* Distance between two table entries in doubles.  */
+#define STRIDE (sizeof (T[0]) / sizeof (double))
+
+/* Inputs in [LO, HI) are handled by __sve_log2_near_one.  */
+#define LO asuint64 (1.0 - 0x1.5b51p-5)
+#define HI asuint64 (1.0 + 0x1.6ab2p-5)
+
+/* log2(x) for x close to 1.0, as __log2_near_one in
+   libmvec_double_vlen2_log2.h.  */
+static __always_inline svfloat64_t
+__sve_log2_near_one(svbool_t pg, svfloat64_t x)
+{
+  svfloat64_t r, r2, r4, y, p, q, hi, lo;
+
+  r = svsub_n_f64_x (pg, x, 1.0);
+  hi = svmul_n_f64_x (pg, r, InvLn2hi);
+  lo = svmla_n_f64_x (pg, svnmls_n_f64_x (pg, hi, r, InvLn2hi), r, InvLn2lo);
+  r2 = svmul_f64_x (pg, r, r); /* rounding error: 0x1p-62.  */
+  r4 = svmul_f64_x (pg, r2, r2);
+  /* Worst-case error is less than 0.54 ULP.  */
+  p = svmul_f64_x (pg, r2, svmla_n_f64_x (pg, svdup_n_f64 (B[0]), r, B[1]));
+  y = svadd_f64_x (pg, hi, p);
+  lo = svadd_f64_x (pg, lo, svadd_f64_x (pg, svsub_f64_x (pg, hi, y), p));
+  q = svmla_f64_x (pg, svmla_n_f64_x (pg, svdup_n_f64 (B[6]), r, B[7]), r2,
+		   svmla_n_f64_x (pg, svdup_n_f64 (B[8]), r, B[9]));
+  p = svmla_f64_x (pg, svmla_n_f64_x (pg, svdup_n_f64 (B[2]), r, B[3]), r2,
+		   svmla_n_f64_x (pg, svdup_n_f64 (B[4]), r, B[5]));
+  p = svmla_f64_x (pg, p, r4, q);
+  lo = svmla_f64_x (pg, lo, r4, p);
+  return svadd_f64_x (pg, y, lo);
+}
+
+/* Results for the lanes that are not positive normal numbers, as
+   __log2_special in libmvec_double_vlen2_log2.h.  */
+static __always_inline svfloat64_t
+__sve_log2_special(svbool_t pg, svfloat64_t x, svfloat64_t y)
+{
+  svfloat64_t e;
+  svbool_t fix;
+
+  fix = svnot_b_z (pg, svand_b_z (pg, svcmpgt_n_f64 (pg, x, 0.0),
+				  svcmple_n_f64 (pg, x, DBL_MAX)));
+  e = svsel_f64 (svcmpeq_n_f64 (pg, x, 0.0), svdup_n_f64 (-INFINITY),
+		 svadd_f64_x (pg, x, x));
+  e = svsel_f64 (svcmplt_n_f64 (pg, x, 0.0), svdup_n_f64 (NAN), e);
+  return svsel_f64 (fix, e, y);
+}
+
+svfloat64_t
+_ZGVsMxv_log2(svfloat64_t x, svbool_t pg)
+{
+  svfloat64_t xn, z, r, r2, r4, kd, invc, logc, t1, t2, t3, hi, lo, p, y;
+  svuint64_t ix, tmp, i;
+  svbool_t special, sub, near1;
+
+  MVEC_STATS_VECTOR (LOG2);
+
+  /* Zero, negative, subnormal, inf and nan lanes.  Subnormal inputs
+     are normalized in the vector, the rest get their result from
+     __sve_log2_special at the end.  */
+  special = svnot_b_z (pg, svand_b_z (pg, svcmpge_n_f64 (pg, x, DBL_MIN),
+				      svcmple_n_f64 (pg, x, DBL_MAX)));
+  MVEC_STATS_LANES (LOG2, SPECIAL, sve_count_lanes_f64 (pg, special));
+  ix = svreinterpret_u64_f64 (x);
+  if (__glibc_unlikely (svptest_any (pg, special)))
+    {
+      sub = svand_b_z (pg, svcmpgt_n_f64 (pg, x, 0.0),
+		       svcmplt_n_f64 (pg, x, DBL_MIN));
+      xn = svmul_n_f64_m (sub, x, 0x1p52);
+      ix = svsub_n_u64_m (sub, svreinterpret_u64_f64 (xn), 52ULL << 52);
+    }
+
+  tmp = svsub_n_u64_x (pg, ix, OFF);
+  i = svand_n_u64_x (pg, svlsr_n_u64_x (pg, tmp, 52 - LOG2_TABLE_BITS),
+		     N - 1);
+  i = svmul_n_u64_x (pg, i, STRIDE);
+  kd = svcvt_f64_s64_x (pg, svasr_n_s64_x (pg, svreinterpret_s64_u64 (tmp),
+					    52));
+  z = svreinterpret_f64_u64 (svsub_u64_x (pg, ix,
+					  svand_n_u64_x (pg, tmp,
+							 0xfffULL << 52)));
+  invc = svld1_gather_u64index_f64 (pg, &T[0].invc, i);
+  logc = svld1_gather_u64index_f64 (pg, &T[0].logc, i);
+
+  r = svmad_n_f64_x (pg, z, invc, -1.0);
+  t1 = svmul_n_f64_x (pg, r, InvLn2hi);
+  t2 = svmla_n_f64_x (pg, svnmls_n_f64_x (pg, t1, r, InvLn2hi), r, InvLn2lo);
+  t3 = svadd_f64_x (pg, kd, logc);
+  hi = svadd_f64_x (pg, t3, t1);
+  lo = svadd_f64_x (pg, svadd_f64_x (pg, svsub_f64_x (pg, t3, hi), t1), t2);
+  r2 = svmul_f64_x (pg, r, r);
+  r4 = svmul_f64_x (pg, r2, r2);
+  p = svmla_f64_x (pg, svmla_n_f64_x (pg, svdup_n_f64 (A[0]), r, A[1]), r2,
+		   svmla_n_f64_x (pg, svdup_n_f64 (A[2]), r, A[3]));
+  p = svmla_f64_x (pg, p, r4, svmla_n_f64_x (pg, svdup_n_f64 (A[4]), r, A[5]));
+  y = svadd_f64_x (pg, svmla_f64_x (pg, lo, r2, p), hi);
+
+  near1 = svcmplt_n_u64 (pg, svsub_n_u64_x (pg, svreinterpret_u64_f64 (x),
+					    LO), HI - LO);
+  MVEC_STATS_LANES (LOG2, NEAR_ONE, sve_count_lanes_f64 (pg, near1));
+  if (svptest_any (pg, near1))
+    y = svsel_f64 (near1, __sve_log2_near_one (pg, x), y);
+  if (__glibc_unlikely (svptest_any (pg, special)))
+    return __sve_log2_special (pg, x, y);
+  return y;
+}
+weak_alias (_ZGVsMxv_log2, _ZGVsMxv___log2_finite)
@@ -0,0 +1,229 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* Based on pow.c from https://github.com/ARM-software/optimized-routines */
+
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "libmvec_sve_util.h"
+
+#define T __pow_log_data.tab
+#define A __pow_log_data.poly
+#define Ln2hi __pow_log_data.ln2hi
+#define Ln2lo __pow_log_data.ln2lo
+#define N (1 << POW_LOG_TABLE_BITS)
+#define OFF 0x3fe6955500000000
+/* Distance between two table entries in doubles.  */
+#define STRIDE (sizeof (T[0]) / sizeof (double))
+
+#define N_EXP (1 << EXP_TABLE_BITS)
+#define InvLn2N __exp_data.invln2N
+#define NegLn2hiN __exp_data.negln2hiN
+#define NegLn2loN __exp_data.negln2loN
+#define T_EXP __exp_data.tab
+#define C2 __exp_data.poly[5 - EXP_POLY_ORDER]
+#define C3 __exp_data.poly[6 - EXP_POLY_ORDER]
+#define C4 __exp_data.poly[7 - EXP_POLY_ORDER]
+#define C5 __exp_data.poly[8 - EXP_POLY_ORDER]
+
+/* Same bounds as in _ZGVnN2vv_pow.  */
+#define BOUND 1024.0
+#define SPECIAL_BOUND 512.0
+
+/* log(x) as the sum of the result and *TAIL, as __pow_log in
+   libmvec_double_vlen2_pow.h.  */
+static __always_inline svfloat64_t
+__sve_pow_log(svbool_t pg, svuint64_t ix, svfloat64_t *tail)
+{
+  svfloat64_t z, r, kd, invc, logc, logctail;
+  svfloat64_t t1, t2, lo1, lo2, lo3, lo4, ar, ar2, ar3, p, q, hi, lo, y;
+  svuint64_t tmp, i;
+
+  tmp = svsub_n_u64_x (pg, ix, OFF);
+  i = svand_n_u64_x (pg, svlsr_n_u64_x (pg, tmp, 52 - POW_LOG_TABLE_BITS),
+		     N - 1);
+  i = svmul_n_u64_x (pg, i, STRIDE);
+  kd = svcvt_f64_s64_x (pg, svasr_n_s64_x (pg, svreinterpret_s64_u64 (tmp),
+					    52));
+  z = svreinterpret_f64_u64 (svsub_u64_x (pg, ix,
+					  svand_n_u64_x (pg, tmp,
+							 0xfffULL << 52)));
+  invc = svld1_gather_u64index_f64 (pg, &T[0].invc, i);
+  logc = svld1_gather_u64index_f64 (pg, &T[0].logc, i);
+  logctail = svld1_gather_u64index_f64 (pg, &T[0].logctail, i);
+
+  /* r = z/c - 1 is exactly representable.  */
+  r = svmad_n_f64_x (pg, z, invc, -1.0);
+
+  /* k*Ln2 + log(c) + r.  */
+  t1 = svmla_n_f64_x (pg, logc, kd, Ln2hi);
+  t2 = svadd_f64_x (pg, t1, r);
+  lo1 = svmla_n_f64_x (pg, logctail, kd, Ln2lo);
+  lo2 = svadd_f64_x (pg, svsub_f64_x (pg, t1, t2), r);
+
+  /* k*Ln2 + log(c) + r + A[0]*r*r.  */
+  ar = svmul_n_f64_x (pg, r, A[0]); /* A[0] == -0.5.  */
+  ar2 = svmul_f64_x (pg, r, ar);
+  ar3 = svmul_f64_x (pg, r, ar2);
+  hi = svadd_f64_x (pg, t2, ar2);
+  lo3 = svnmls_f64_x (pg, ar2, ar, r);
+  lo4 = svadd_f64_x (pg, svsub_f64_x (pg, t2, hi), ar2);
+
+  /* p = log1p(r) - r - A[0]*r*r.  */
+  q = svmla_n_f64_x (pg, svdup_n_f64 (A[5]), r, A[6]);
+  q = svmla_f64_x (pg, svmla_n_f64_x (pg, svdup_n_f64 (A[3]), r, A[4]),
+		   ar2, q);
+  p = svmla_f64_x (pg, svmla_n_f64_x (pg, svdup_n_f64 (A[1]), r, A[2]),
+		   ar2, q);
+  p = svmul_f64_x (pg, ar3, p);
+  lo = svadd_f64_x (pg, svadd_f64_x (pg, lo1, lo2), svadd_f64_x (pg, lo3, lo4));
+  lo = svadd_f64_x (pg, lo, p);
+  y = svadd_f64_x (pg, hi, lo);
+  *tail = svadd_f64_x (pg, svsub_f64_x (pg, hi, y), lo);
+  return y;
+}
+
+/* exp(x + xtail), as __pow_exp in libmvec_double_vlen2_pow.h.  */
+static __always_inline svfloat64_t
+__sve_pow_exp(svbool_t pg, svfloat64_t x, svfloat64_t xtail)
+{
+  svfloat64_t z, kd, r, r2, tail, scale, tmp, y;
+  svuint64_t ki, idx, sbits;
+  svbool_t special;
+
+  /* Once x is clamped the tail no longer belongs to it.  */
+  xtail = svsel_f64 (svacgt_n_f64 (pg, x, BOUND), svdup_n_f64 (0.0), xtail);
+  x = svmin_n_f64_x (pg, x, BOUND);
+  x = svmax_n_f64_x (pg, x, -BOUND);
+  special = svacgt_n_f64 (pg, x, SPECIAL_BOUND);
+  MVEC_STATS_LANES (POW, RANGE, sve_count_lanes_f64 (pg, special));
+
+  z = svmul_n_f64_x (pg, x, InvLn2N);
+  kd = svrinta_f64_x (pg, z);
+  ki = svreinterpret_u64_s64 (svcvt_s64_f64_x (pg, kd));
+
+  idx = svlsl_n_u64_x (pg, svand_n_u64_x (pg, ki, N_EXP - 1), 1);
+  sbits = svld1_gather_u64index_u64 (pg, T_EXP + 1, idx);
+  sbits = svadd_u64_x (pg, sbits,
+		       svlsl_n_u64_x (pg, ki, 52 - EXP_TABLE_BITS));
+  scale = svreinterpret_f64_u64 (sbits);
+  tail = svreinterpret_f64_u64 (svld1_gather_u64index_u64 (pg, T_EXP, idx));
+
+  r = svmla_n_f64_x (pg, x, kd, NegLn2hiN);
+  r = svmla_n_f64_x (pg, r, kd, NegLn2loN);
+  /* The code assumes 2^-200 < |xtail| < 2^-8/N.  */
+  r = svadd_f64_x (pg, r, xtail);
+  r2 = svmul_f64_x (pg, r, r);
+  tmp = svmla_f64_x (pg, svdup_n_f64 (C4), r, svdup_n_f64 (C5));
+  tmp = svmul_f64_x (pg, svmul_f64_x (pg, r2, r2), tmp);
+  tmp = svmla_f64_x (pg, tmp, r2,
+		     svmla_f64_x (pg, svdup_n_f64 (C2), r, svdup_n_f64 (C3)));
+  tmp = svadd_f64_x (pg, svadd_f64_x (pg, tail, r), tmp);
+  y = svmla_f64_x (pg, scale, scale, tmp);
+  if (__glibc_unlikely (svptest_any (pg, special)))
+    y = svsel_f64 (special,
+		   sve_exp_specialcase (pg, tmp, sbits,
+					svcmpgt_n_f64 (pg, x, 0.0)),
+		   y);
+  return y;
+}
+
+/* Results for the lanes where x is zero, inf or nan or y is inf or
+   nan, following the special cases of the scalar pow.  ODD marks the
+   lanes with an odd integer y.  */
+static __always_inline svfloat64_t
+__sve_pow_special(svbool_t pg, svfloat64_t x, svfloat64_t y, svbool_t odd)
+{
+  svfloat64_t x2, e, ax;
+  svbool_t zero;
+
+  /* x is +-0 or +-inf.  */
+  x2 = svmul_f64_x (pg, x, x);
+  x2 = svneg_f64_m (x2, svand_b_z (pg, odd, svcmplt_n_f64 (pg, x, 0.0)), x2);
+  e = svsel_f64 (svcmplt_n_f64 (pg, y, 0.0), svdivr_n_f64_x (pg, x2, 1.0),
+		 x2);
+
+  /* y is +-inf: 1 for |x| == 1, inf when |x| > 1 and y > 0 or
+     |x| < 1 and y < 0, 0 otherwise.  */
+  ax = svabs_f64_x (pg, x);
+  zero = sveor_b_z (pg, svcmplt_n_f64 (pg, ax, 1.0),
+		   svcmplt_n_f64 (pg, y, 0.0));
+  e = svsel_f64 (svcmpeq_n_f64 (pg, svabs_f64_x (pg, y), INFINITY),
+		 svsel_f64 (svcmpeq_n_f64 (pg, ax, 1.0), svdup_n_f64 (1.0),
+			    svsel_f64 (zero, svdup_n_f64 (0.0),
+				       svdup_n_f64 (INFINITY))),
+		 e);
+
+  /* nan in either argument, except pow(1, y) and pow(x, 0).  */
+  e = svsel_f64 (svcmpuo_f64 (pg, x, y), svadd_f64_x (pg, x, y), e);
+  e = svsel_f64 (svorr_b_z (pg, svcmpeq_n_f64 (pg, x, 1.0),
+			    svcmpeq_n_f64 (pg, y, 0.0)),
+		 svdup_n_f64 (1.0), e);
+  return e;
+}
+
+svfloat64_t
+_ZGVsMxvv_pow(svfloat64_t x, svfloat64_t y, svbool_t pg)
+{
+  svfloat64_t ax, ys, yh, hi, lo, ehi, elo, r;
+  svuint64_t ix;
+  svbool_t special, neg, yint, odd, invalid, sub;
+
+  MVEC_STATS_VECTOR (POW);
+
+  /* Lanes where x is zero, inf or nan or y is inf or nan get their
+     result from __sve_pow_special, they are replaced by 1^1 in the
+     main evaluation.  */
+  ax = svabs_f64_x (pg, x);
+  special = svnot_b_z (pg, svand_b_z (pg, svand_b_z (pg, svcmpgt_n_f64 (pg, ax, 0.0),
+						       svcmple_n_f64 (pg, ax, DBL_MAX)),
+				      svacle_n_f64 (pg, y, DBL_MAX)));
+  MVEC_STATS_LANES (POW, SPECIAL, sve_count_lanes_f64 (pg, special));
+  ax = svsel_f64 (special, svdup_n_f64 (1.0), ax);
+  ys = svsel_f64 (special, svdup_n_f64 (1.0), y);
+
+  /* pow(x, y) = +-pow(|x|, y) for x < 0 and integer y, with the sign
+     of x when y is odd, and nan when y is not an integer.  */
+  neg = svcmplt_n_f64 (pg, x, 0.0);
+  yint = svcmpeq_f64 (pg, svrintz_f64_x (pg, y), y);
+  yh = svmul_n_f64_x (pg, y, 0.5);
+  odd = svand_b_z (pg, yint, svcmpne_f64 (pg, svrintz_f64_x (pg, yh), yh));
+  invalid = svbic_b_z (pg, neg, yint);
+
+  /* Normalize subnormal x.  */
+  ix = svreinterpret_u64_f64 (ax);
+  sub = svcmplt_n_f64 (pg, ax, DBL_MIN);
+  if (__glibc_unlikely (svptest_any (pg, sub)))
+    ix = svsub_n_u64_m (sub,
+			svreinterpret_u64_f64 (svmul_n_f64_m (sub, ax, 0x1p52)),
+			52ULL << 52);
+
+  /* y*log(x) as ehi + elo, then exp of the sum.  */
+  hi = __sve_pow_log (pg, ix, &lo);
+  ehi = svmul_f64_x (pg, ys, hi);
+  elo = svmla_f64_x (pg, svnmls_f64_x (pg, ehi, ys, hi), ys, lo);
+  r = __sve_pow_exp (pg, ehi, elo);
+  r = svneg_f64_m (r, svand_b_z (pg, neg, odd), r);
+
+  r = svsel_f64 (invalid, svdup_n_f64 (NAN), r);
+  if (__glibc_unlikely (svptest_any (pg, special)))
+    r = svsel_f64 (special, __sve_pow_special (pg, x, y, odd), r);
+  return r;
+}
+weak_alias (_ZGVsMxvv_pow, _ZGVsMxvv___pow_finite)
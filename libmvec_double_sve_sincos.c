@@ -0,0 +1,236 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdint.h>
+#include <math.h>
+#include "endian.h"
+#include "libmvec_double_sinetable.h"
+#include "libmvec_sve_util.h"
+
+#define CUTOFF 1000.00
+
+//
+// argument reduction for |x| > CUTOFF, as _sine_reduce_large in
+// libmvec_double_sinekernel.h
+//
+
+/* 48 bits of _inv_modulus_bits starting at bit T, as an integer.  */
+static inline svfloat64_t
+_sve_inv_modulus_chunk(svbool_t pg, svuint64_t t)
+{
+  svuint64_t w, s, b0, b1, b2, v;
+
+  w = svlsr_n_u64_x (pg, t, 5);
+  s = svand_n_u64_x (pg, t, 31);
+  b0 = svld1uw_gather_u64index_u64 (pg, _inv_modulus_bits, w);
+  b1 = svld1uw_gather_u64index_u64 (pg, _inv_modulus_bits + 1, w);
+  b2 = svld1uw_gather_u64index_u64 (pg, _inv_modulus_bits + 2, w);
+  v = svorr_u64_x (pg, svlsl_n_u64_x (pg, b0, 32), b1);
+  v = svorr_u64_x (pg, svlsl_u64_x (pg, v, s),
+		   svlsr_u64_x (pg, b2, svsubr_n_u64_x (pg, s, 32)));
+  return svcvt_f64_u64_x (pg, svlsr_n_u64_x (pg, v, 16));
+}
+
+/* s + *t == a + b exactly.  */
+static inline svfloat64_t
+_sve_two_sum(svbool_t pg, svfloat64_t a, svfloat64_t b, svfloat64_t *t)
+{
+  svfloat64_t s, bb;
+
+  s = svadd_f64_x (pg, a, b);
+  bb = svsub_f64_x (pg, s, a);
+  *t = svadd_f64_x (pg, svsub_f64_x (pg, a, svsub_f64_x (pg, s, bb)),
+		    svsub_f64_x (pg, b, bb));
+  return s;
+}
+
+static inline svfloat64_t
+_sve_reduce_large(svbool_t pg, svfloat64_t a, svfloat64_t *x0,
+		  svfloat64_t *r1)
+{
+  const double *modulus = (const double *)_modulus;
+  svfloat64_t m, d0, d1, d2, d3, p0, p1, p2, p3, e0, e1, e2;
+  svfloat64_t h, k, lo, l1, l2, l3, l4, l5, l6, fh, fl;
+  svuint64_t ia, t;
+
+  ia = svreinterpret_u64_f64 (a);
+  m = svreinterpret_f64_u64 (svorr_n_u64_x (pg, svand_n_u64_x (pg, ia, 0xfffffffffffffULL),
+					    0x3ffULL << 52));
+  t = svsub_n_u64_x (pg, svlsr_n_u64_x (pg, ia, 52), 0x3ff - 10);
+  d0 = svmul_n_f64_x (pg, _sve_inv_modulus_chunk (pg, t), 0x1p9);
+  d1 = svmul_n_f64_x (pg, _sve_inv_modulus_chunk (pg, svadd_n_u64_x (pg, t, 48)),
+		      0x1p-39);
+  d2 = svmul_n_f64_x (pg, _sve_inv_modulus_chunk (pg, svadd_n_u64_x (pg, t, 96)),
+		      0x1p-87);
+  d3 = svmul_n_f64_x (pg, _sve_inv_modulus_chunk (pg, svadd_n_u64_x (pg, t, 144)),
+		      0x1p-135);
+
+  p0 = svmul_f64_x (pg, m, d0);
+  e0 = svnmls_f64_x (pg, p0, m, d0);
+  p1 = svmul_f64_x (pg, m, d1);
+  e1 = svnmls_f64_x (pg, p1, m, d1);
+  p2 = svmul_f64_x (pg, m, d2);
+  e2 = svnmls_f64_x (pg, p2, m, d2);
+  p3 = svmul_f64_x (pg, m, d3);
+  p0 = svmls_n_f64_x (pg, p0, svrinta_f64_x (pg, svmul_n_f64_x (pg, p0, 0x1p-5)),
+		      32.0);
+  p1 = svmls_n_f64_x (pg, p1, svrinta_f64_x (pg, svmul_n_f64_x (pg, p1, 0x1p-5)),
+		      32.0);
+
+  h = _sve_two_sum (pg, p0, p1, &l1);
+  h = _sve_two_sum (pg, h, e0, &l2);
+  k = svrinta_f64_x (pg, h);
+  h = svsub_f64_x (pg, h, k);
+  h = _sve_two_sum (pg, h, l1, &l3);
+  h = _sve_two_sum (pg, h, l2, &l4);
+  h = _sve_two_sum (pg, h, p2, &l5);
+  h = _sve_two_sum (pg, h, e1, &l6);
+  lo = svadd_f64_x (pg, svadd_f64_x (pg, l3, l4), svadd_f64_x (pg, l5, l6));
+  lo = svadd_f64_x (pg, lo, svadd_f64_x (pg, e2, p3));
+  fh = _sve_two_sum (pg, h, lo, &fl);
+
+  *x0 = svmul_n_f64_x (pg, fh, modulus[0]);
+  *r1 = svnmls_n_f64_x (pg, *x0, fh, modulus[0]);
+  *r1 = svmla_n_f64_x (pg, *r1, fh, modulus[2]);
+  *r1 = svmla_n_f64_x (pg, *r1, fl, modulus[0]);
+  return svmls_n_f64_x (pg, k, svrintm_f64_x (pg, svmul_n_f64_x (pg, k, 0x1p-5)),
+			32.0);
+}
+
+//
+// main body of routine, as _sine_kernel in libmvec_double_vlen2_sincos.h
+//
+
+static inline svfloat64_t
+_sve_sine_kernel(svbool_t pg, svfloat64_t x, const double *tbl, uint64_t sym)
+{
+  const double *sinpoly, *cospoly, *modulus;
+  svfloat64_t a, a0, a1, a2, k, t0, t1, x0, x1, x02, c0, r1;
+  svfloat64_t hiref, loref, tbl2, tbl3, result, kl, x0l, r1l;
+  svuint64_t tablebase;
+  svbool_t large;
+
+  sinpoly = (const double *)_sin_poly;
+  cospoly = (const double *)_cos_poly;
+  modulus = (const double *)_modulus;
+
+  a = svabs_f64_x (pg, x);
+  a1 = svmul_n_f64_x (pg, a, ((const double *)_vmod)[0]); /* 1/(2*PI/32) */
+  k = svrinta_f64_x (pg, a1);
+  t0 = svmul_n_f64_x (pg, k, modulus[0]);
+  /* We need to explicitly use fma for the extra precision. */
+  t1 = svnmls_n_f64_x (pg, t0, k, modulus[0]);
+  a1 = svmul_n_f64_x (pg, k, modulus[2]);
+  /* We need to explicitly use fma for the extra precision. */
+  a2 = svnmls_n_f64_x (pg, a1, k, modulus[2]);
+  a0 = svsub_f64_x (pg, a, t0);
+  a1 = svadd_f64_x (pg, a1, t1); /* add remainder from 1st term to 2nd term */
+  x0 = svsub_f64_x (pg, a0, a1);
+  x1 = svsub_f64_x (pg, svsub_f64_x (pg, a0, x0), a1);
+  r1 = svsub_f64_x (pg, x1, a2);
+  r1 = svmls_n_f64_x (pg, r1, k, modulus[4]);
+
+  large = svacgt_n_f64 (pg, x, CUTOFF);
+  if (__glibc_unlikely (svptest_any (pg, large)))
+    {
+      kl = _sve_reduce_large (large, a, &x0l, &r1l);
+      k = svsel_f64 (large, kl, k);
+      x0 = svsel_f64 (large, x0l, x0);
+      r1 = svsel_f64 (large, r1l, r1);
+    }
+  tablebase = svcvt_u64_f64_x (pg, k);
+
+  tablebase = svadd_n_u64_m (svnot_b_z (pg, svcmpgt_n_f64 (pg, x, 0.0)),
+			     tablebase, sym);
+  tablebase = svand_n_u64_x (pg, svlsl_n_u64_x (pg, tablebase, 2), 0x7c);
+  hiref = svld1_gather_u64index_f64 (pg, tbl, tablebase);
+  loref = svld1_gather_u64index_f64 (pg, tbl + 1, tablebase);
+  c0 = svsub_f64_x (pg, x0, hiref);
+  x1 = svsub_f64_x (pg, svsub_f64_x (pg, x0, c0), hiref);
+  x0 = c0;
+  x1 = svsub_f64_x (pg, svadd_f64_x (pg, x1, r1), loref);
+  x02 = svmul_f64_x (pg, x0, x0); /* reduced x^2 for poly */
+  t0 = svmla_n_f64_x (pg, svdup_n_f64 (sinpoly[3]), x02, sinpoly[4]);
+  t0 = svmad_n_f64_x (pg, t0, x02, sinpoly[2]);
+  t0 = svmad_n_f64_x (pg, t0, x02, sinpoly[1]);
+  t0 = svmad_n_f64_x (pg, t0, x02, sinpoly[0]);
+  t0 = svmul_f64_x (pg, t0, x02);
+  t0 = svmla_f64_x (pg, x1, x0, t0);
+  t0 = svadd_f64_x (pg, t0, x0);
+  tbl3 = svld1_gather_u64index_f64 (pg, tbl + 3, tablebase);
+  t0 = svmul_f64_x (pg, t0, tbl3);        /* cos of ref, gives cos(a)*sin(b) */
+  t1 = svmla_n_f64_x (pg, svdup_n_f64 (cospoly[3]), x02, cospoly[4]);
+  t1 = svmad_n_f64_x (pg, t1, x02, cospoly[2]);
+  t1 = svmad_n_f64_x (pg, t1, x02, cospoly[1]);
+  t1 = svmad_n_f64_x (pg, t1, x02, cospoly[0]);
+  t1 = svmul_f64_x (pg, t1, x02);
+  tbl2 = svld1_gather_u64index_f64 (pg, tbl + 2, tablebase);
+  t1 = svmul_f64_x (pg, t1, tbl2);        /* sin of ref */
+  result = svadd_f64_x (pg, t1, t0);
+  result = svadd_f64_x (pg, result, tbl2); /* add sine */
+  return(result);
+}
+
+//
+// sine entry point
+//
+
+svfloat64_t _ZGVsMxv_sin(svfloat64_t x, svbool_t pg)
+{
+svfloat64_t result, xs;
+svbool_t nonfinite;
+
+  MVEC_STATS_VECTOR (SIN);
+
+  /* inf and nan lanes are fed to the kernel as zero and give nan.  */
+  nonfinite = svnot_b_z (pg, svaclt_n_f64 (pg, x, INFINITY));
+  xs = svsel_f64 (nonfinite, svdup_n_f64 (0.0), x);
+  MVEC_STATS_LANES (SIN, SPECIAL, sve_count_lanes_f64 (pg, nonfinite));
+  MVEC_STATS_LANES (SIN, RANGE,
+		    sve_count_lanes_f64 (pg, svacgt_n_f64 (pg, xs, CUTOFF)));
+
+  result = _sve_sine_kernel(pg, xs, (const double *)_sin_table, 1<<4);
+  /* _sve_sine_kernel returns +0 for sin(-0).  */
+  result = svsel_f64 (svcmpeq_n_f64 (pg, x, 0.0), x, result);
+  result = svsel_f64 (nonfinite, svsub_f64_x (pg, x, x), result);
+  return (result);
+}
+weak_alias (_ZGVsMxv_sin, _ZGVsMxv___sin_finite)
+
+//
+// cosine entry point
+//
+
+svfloat64_t _ZGVsMxv_cos(svfloat64_t x, svbool_t pg)
+{
+svfloat64_t result, xs;
+svbool_t nonfinite;
+
+  MVEC_STATS_VECTOR (COS);
+
+  /* inf and nan lanes are fed to the kernel as zero and give nan.  */
+  nonfinite = svnot_b_z (pg, svaclt_n_f64 (pg, x, INFINITY));
+  xs = svsel_f64 (nonfinite, svdup_n_f64 (0.0), x);
+  MVEC_STATS_LANES (COS, SPECIAL, sve_count_lanes_f64 (pg, nonfinite));
+  MVEC_STATS_LANES (COS, RANGE,
+		    sve_count_lanes_f64 (pg, svacgt_n_f64 (pg, xs, CUTOFF)));
+
+  result = _sve_sine_kernel(pg, xs, (const double *)_cos_table, 0);
+  result = svsel_f64 (nonfinite, svsub_f64_x (pg, x, x), result);
+  return (result);
+}
+weak_alias (_ZGVsMxv_cos, _ZGVsMxv___cos_finite)
@@ -0,0 +1,153 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _LIBMVEC_DOUBLE_VLEN2_ASIN_H
+#define _LIBMVEC_DOUBLE_VLEN2_ASIN_H
+
+#include <stdint.h>
+#include <math.h>
+#include "endian.h"
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+
+/* asin(sqrt(z))/sqrt(z) = 1 + z * P(z) on [0, 1/4].  The approximation
+   error of asin is below 2^-57 relative.  */
+#define P __asin_poly
+#define Pio2hi 0x1.921fb54442d18p+0
+#define Pio2lo 0x1.1a62633145c07p-54
+#define Pihi 0x1.921fb54442d18p+1
+#define Pilo 0x1.1a62633145c07p-53
+
+/* Shared reduction of asin and acos for A = |x|.  Lanes with A < 1/2
+   (SMALL) use asin(A) directly and get S = A, C = 0.  The others use
+   asin(A) = pi/2 - 2 asin(sqrt(z)) with z = (1 - A)/2, which is exact,
+   and get S + C = sqrt(z) to about twice the working precision.  The
+   return value Q = z * P(z) gives asin(S + C) ~= S + (C + S * Q).
+   A > 1 gives nan through the square root.  */
+static __always_inline __Float64x2_t
+__asin_reduce(__Float64x2_t a, __Uint64x2_t small, __Float64x2_t *sp,
+	      __Float64x2_t *cp)
+{
+  __Float64x2_t z, s, c, z2, z4, z8, y;
+  __Float64x2_t P0_v, P1_v, P2_v, P3_v, P4_v, P5_v, P6_v;
+  __Float64x2_t P7_v, P8_v, P9_v, P10_v, P11_v, P12_v;
+
+  z = select_v2df (small, a * a, (1.0 - a) * 0.5);
+  s = select_v2df (small, a, __builtin_aarch64_sqrtv2df (z));
+  /* The residual of the square root; s == 0 only for |x| == 1.  */
+  c = __builtin_aarch64_fmav2df (-s, s, z) / (s + s);
+  c = select_v2df (small | (__Uint64x2_t) (s == 0.0),
+		   (__Float64x2_t) { 0.0, 0.0 }, c);
+
+  P0_v = P[0];
+  P1_v = P[1];
+  P2_v = P[2];
+  P3_v = P[3];
+  P4_v = P[4];
+  P5_v = P[5];
+  P6_v = P[6];
+  P7_v = P[7];
+  P8_v = P[8];
+  P9_v = P[9];
+  P10_v = P[10];
+  P11_v = P[11];
+  P12_v = P[12];
+
+  z2 = z * z;
+  z4 = z2 * z2;
+  z8 = z4 * z4;
+  y = (P0_v + z * P1_v) + z2 * (P2_v + z * P3_v)
+      + z4 * ((P4_v + z * P5_v) + z2 * (P6_v + z * P7_v))
+      + z8 * ((P8_v + z * P9_v) + z2 * (P10_v + z * P11_v) + z4 * P12_v);
+
+  *sp = s;
+  *cp = c;
+  return z * y;
+}
+
+//
+// arcsine entry point
+//
+
+static __always_inline __Float64x2_t
+__asin_v2df(__Float64x2_t x)
+{
+  __Float64x2_t a, s, c, q, r, hi, lo;
+  __Uint64x2_t small, sign;
+
+  MVEC_STATS_VECTOR (ASIN);
+
+  a = __builtin_aarch64_absv2df (x);
+  small = (__Uint64x2_t) (a < 0.5);
+  q = __asin_reduce (a, small, &s, &c);
+
+  r = s + s * q;
+  if (any_lane_v2di (~small))
+    {
+      /* pi/2 - 2s is rounded to a value close to 1 where the result
+	 is just below it, so keep its rounding error in LO.  */
+      hi = Pio2hi - 2.0 * s;
+      lo = (Pio2hi - hi) - 2.0 * s;
+      lo = lo + (Pio2lo - 2.0 * (c + s * q));
+      r = select_v2df (small, r, hi + lo);
+    }
+  sign = (__Uint64x2_t) x & 0x8000000000000000;
+  return (__Float64x2_t) ((__Uint64x2_t) r | sign);
+}
+
+//
+// arccosine entry point
+//
+
+/* acos(x) = pi/2 - asin(x) for |x| < 1/2, 2 asin(sqrt(z)) for
+   x >= 1/2 and pi - 2 asin(sqrt(z)) for x <= -1/2.  */
+static __always_inline __Float64x2_t
+__acos_v2df(__Float64x2_t x)
+{
+  __Float64x2_t a, s, c, q, r, t, pos, hi, lo;
+  __Uint64x2_t small;
+
+  MVEC_STATS_VECTOR (ACOS);
+
+  a = __builtin_aarch64_absv2df (x);
+  small = (__Uint64x2_t) (a < 0.5);
+  q = __asin_reduce (a, small, &s, &c);
+
+  /* The constant minus the leading term is split into HI and LO with
+     its exact rounding error in LO.  */
+  t = select_v2df (small, x, s);
+  hi = Pio2hi - t;
+  lo = ((Pio2hi - hi) - t) + (Pio2lo - t * q);
+  r = hi + lo;
+  if (any_lane_v2di (~small))
+    {
+      t = c + s * q;
+      pos = 2.0 * s + 2.0 * t;
+      hi = Pihi - 2.0 * s;
+      lo = ((Pihi - hi) - 2.0 * s) + (Pilo - 2.0 * t);
+      r = select_v2df (small, r, select_v2df ((__Uint64x2_t) (x > 0.0),
+					      pos, hi + lo));
+    }
+  return r;
+}
+
+#undef P
+#undef Pio2hi
+#undef Pio2lo
+#undef Pihi
+#undef Pilo
+
+#endif
@@ -0,0 +1,203 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _LIBMVEC_DOUBLE_VLEN2_ATAN_H
+#define _LIBMVEC_DOUBLE_VLEN2_ATAN_H
+
+#include <stdint.h>
+#include <math.h>
+#include "endian.h"
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+
+/* K + S * B as hi and lo parts, indexed by 3 * QUAD + I, where B is
+   atan(0), atan(1/2) or atan(1) for I = 0, 1, 2 and QUAD selects
+   K, S = 0, 1; pi/2, -1; pi, -1; pi/2, 1.  */
+static const double __atan_base[12][2] __attribute__ ((aligned (16))) = {
+  { 0x0.0p+0, 0x0.0p+0 },
+  { 0x1.dac670561bb4fp-2, 0x1.a2b7f222f65e2p-56 },
+  { 0x1.921fb54442d18p-1, 0x1.1a62633145c07p-55 },
+  { 0x1.921fb54442d18p+0, 0x1.1a62633145c07p-54 },
+  { 0x1.1b6e192ebbe44p+0, 0x1.b1b466a88828ep-54 },
+  { 0x1.921fb54442d18p-1, 0x1.1a62633145c07p-55 },
+  { 0x1.921fb54442d18p+1, 0x1.1a62633145c07p-53 },
+  { 0x1.56c6e7397f5aep+1, 0x1.660b64ece6f4bp-53 },
+  { 0x1.2d97c7f3321d2p+1, 0x1.a79394c9e8a0ap-54 },
+  { 0x1.921fb54442d18p+0, 0x1.1a62633145c07p-54 },
+  { 0x1.0468a8ace4df6p+1, 0x1.0620bf7406affp-55 },
+  { 0x1.2d97c7f3321d2p+1, 0x1.a79394c9e8a0ap-54 },
+};
+
+/* atan(sqrt(t))/sqrt(t) = 1 + t * P(t) on [0, 0.1915], the range of
+   z^2 after the reduction below.  The approximation error is below
+   2^-60.  */
+#define P __atan_poly
+#define T __atan_base
+
+/* Return atan(MN/MX) for 0 <= MN <= MX, MX + MX finite and normal,
+   folded into the quadrant given by the masks: pi/2 - atan where only
+   SWAP is set, pi - atan where only NEG is set and pi/2 + atan where
+   both are.  MN/MX is reduced with atan(q) = atan(c) + atan(z),
+   z = (q - c)/(1 + c*q), where c is 0, 1/2 or 1, so |z| <= 7/16, and
+   the result is K + S * (atan(c) + atan(z)) with the constant part
+   taken from T in two parts.  */
+static __always_inline __Float64x2_t
+__atan_kernel(__Float64x2_t mn, __Float64x2_t mx, __Uint64x2_t swap,
+	      __Uint64x2_t neg)
+{
+  __Float64x2_t c, z, t, t2, t4, t8, p, y, hi, lo;
+  __Float64x2_t P0_v, P1_v, P2_v, P3_v, P4_v, P5_v;
+  __Float64x2_t P6_v, P7_v, P8_v, P9_v, P10_v, P11_v;
+  __Uint64x2_t mid, big, i;
+
+  mid = (__Uint64x2_t) (mn >= 0x1.cp-2 * mx);	/* q >= 7/16 */
+  big = (__Uint64x2_t) (mn >= 0x1.6p-1 * mx);	/* q >= 11/16 */
+  c = select_v2df (big, (__Float64x2_t) { 1.0, 1.0 },
+		   select_v2df (mid, (__Float64x2_t) { 0.5, 0.5 },
+				(__Float64x2_t) { 0.0, 0.0 }));
+  /* c * mx is exact and so is mn - c * mx for q >= c/2.  */
+  z = (mn - c * mx) / (mx + c * mn);
+
+  P0_v = P[0];
+  P1_v = P[1];
+  P2_v = P[2];
+  P3_v = P[3];
+  P4_v = P[4];
+  P5_v = P[5];
+  P6_v = P[6];
+  P7_v = P[7];
+  P8_v = P[8];
+  P9_v = P[9];
+  P10_v = P[10];
+  P11_v = P[11];
+
+  t = z * z;
+  t2 = t * t;
+  t4 = t2 * t2;
+  t8 = t4 * t4;
+  y = (P0_v + t * P1_v) + t2 * (P2_v + t * P3_v)
+      + t4 * ((P4_v + t * P5_v) + t2 * (P6_v + t * P7_v))
+      + t8 * ((P8_v + t * P9_v) + t2 * (P10_v + t * P11_v));
+  p = z + z * t * y;
+
+  i = (mid & 1) + (big & 1) + 3 * (swap & 1) + 6 * (neg & 1);
+  lookup_pair_v2df (T[i[0]], T[i[1]], &hi, &lo);
+  p = select_v2df (swap ^ neg, -p, p);
+  return hi + (lo + p);
+}
+
+/* Set the sign of the nonnegative R to the sign of X.  */
+static __always_inline __Float64x2_t
+__atan_copysign(__Float64x2_t r, __Float64x2_t x)
+{
+  __Uint64x2_t sign = (__Uint64x2_t) x & 0x8000000000000000;
+
+  return (__Float64x2_t) ((__Uint64x2_t) r | sign);
+}
+
+//
+// arctangent entry point
+//
+
+/* atan(|x|) = atan2(|x|, 1), with the quotient taken as min/max of
+   |x| and 1.  nans propagate through the min and max.  */
+static __always_inline __Float64x2_t
+__atan_v2df(__Float64x2_t x)
+{
+  __Float64x2_t a, one, mn, mx, r;
+  __Uint64x2_t swap, zero, inf;
+
+  MVEC_STATS_VECTOR (ATAN);
+
+  a = __builtin_aarch64_absv2df (x);
+  one = (__Float64x2_t) { 1.0, 1.0 };
+  mn = __builtin_aarch64_smin_nanv2df (a, one);
+  mx = __builtin_aarch64_smax_nanv2df (a, one);
+  swap = (__Uint64x2_t) (a > one);
+  zero = (__Uint64x2_t) { 0, 0 };
+
+  /* atan(inf) is reduced as q = 0, which gives pi/2.  */
+  inf = (__Uint64x2_t) (a == INFINITY);
+  MVEC_STATS_LANES (ATAN, SPECIAL, count_lanes_v2di (inf));
+  if (__glibc_unlikely (any_lane_v2di (inf)))
+    {
+      mn = select_v2df (inf, (__Float64x2_t) { 0.0, 0.0 }, mn);
+      mx = select_v2df (inf, one, mx);
+    }
+
+  r = __atan_kernel (mn, mx, swap, zero);
+  return __atan_copysign (r, x);
+}
+
+//
+// two-argument arctangent entry point
+//
+
+static __always_inline __Float64x2_t
+__atan2_v2df(__Float64x2_t y, __Float64x2_t x)
+{
+  __Float64x2_t ax, ay, mn, mx, r;
+  __Uint64x2_t swap, neg, special, bothinf, scale;
+
+  MVEC_STATS_VECTOR (ATAN2);
+
+  ax = __builtin_aarch64_absv2df (x);
+  ay = __builtin_aarch64_absv2df (y);
+  mn = __builtin_aarch64_smin_nanv2df (ax, ay);
+  mx = __builtin_aarch64_smax_nanv2df (ax, ay);
+  swap = (__Uint64x2_t) (ay > ax);
+  neg = (__Uint64x2_t) ((__Int64x2_t) x < 0);
+
+  /* Zero, infinite and nan lanes.  Both zero gives q = 0, one infinite
+     q = 0 and both infinite q = 1, which with SWAP and NEG give the
+     signed zeros and multiples of pi/4.  nan lanes are replaced at
+     the end.  */
+  special = (__Uint64x2_t) ~((mx > 0.0) & (mx < INFINITY));
+  MVEC_STATS_LANES (ATAN2, SPECIAL, count_lanes_v2di (special));
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    {
+      bothinf = (__Uint64x2_t) (mn == INFINITY);
+      mn = select_v2df (special,
+			select_v2df (bothinf, (__Float64x2_t) { 1.0, 1.0 },
+				     (__Float64x2_t) { 0.0, 0.0 }), mn);
+      mx = select_v2df (special, (__Float64x2_t) { 1.0, 1.0 }, mx);
+    }
+
+  /* Keep mx + c * mn finite and the products with mx used for the
+     reduction normal.  The scaling is exact except for subnormal mn
+     next to huge mx, where the result underflows anyway.  */
+  scale = (__Uint64x2_t) ((mx > 0x1p1022) | (mx < 0x1p-900));
+  MVEC_STATS_LANES (ATAN2, RANGE, count_lanes_v2di (scale));
+  if (__glibc_unlikely (any_lane_v2di (scale)))
+    {
+      __Float64x2_t f = select_v2df ((__Uint64x2_t) (mx > 1.0),
+				     (__Float64x2_t) { 0.5, 0.5 },
+				     (__Float64x2_t) { 0x1p200, 0x1p200 });
+      mn = select_v2df (scale, mn * f, mn);
+      mx = select_v2df (scale, mx * f, mx);
+    }
+
+  r = __atan_kernel (mn, mx, swap, neg);
+  r = __atan_copysign (r, y);
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    r = select_v2df ((__Uint64x2_t) ((x != x) | (y != y)), x + y, r);
+  return r;
+}
+
+#undef P
+#undef T
+
+#endif
@@ -0,0 +1,125 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on exp2.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_DOUBLE_VLEN2_EXP2_H
+#define _LIBMVEC_DOUBLE_VLEN2_EXP2_H
+
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <ieee754.h>
+#include <math-narrow-eval.h>
+#include "math_config.h"
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+
+#define N (1 << EXP_TABLE_BITS)
+#define Shift __exp_v2df_data.exp2_shift
+#define T __exp_data.tab
+#ifdef LIBMVEC_LOW_ACCURACY
+/* 2^r - 1 ~= r * (C1 + r*C2 + r^2*C3 + r^3*C4) for |r| <= 1/256,
+   relative error 2^-53.4.  */
+# define C1 __exp2_poly_low[0]
+# define C2 __exp2_poly_low[1]
+# define C3 __exp2_poly_low[2]
+# define C4 __exp2_poly_low[3]
+#else
+# define C1 __exp_v2df_data.exp2_poly[0]
+# define C2 __exp_v2df_data.exp2_poly[1]
+# define C3 __exp_v2df_data.exp2_poly[2]
+# define C4 __exp_v2df_data.exp2_poly[3]
+# define C5 __exp_v2df_data.exp2_poly[4]
+#endif
+
+/* exp2(x) overflows for x >= 1024 and underflows to zero for
+   x <= -1075, clamping x to [LO_BOUND, HI_BOUND] keeps every result
+   while keeping k representable.  Lanes with |x| above SPECIAL_BOUND
+   may overflow or underflow the exponent of scale.  */
+#define HI_BOUND 1024.0
+#define LO_BOUND -1075.0
+#define SPECIAL_BOUND 512.0
+
+static __always_inline __Float64x2_t
+__exp2_v2df(__Float64x2_t x)
+{
+  __Float64x2_t g, kd_v, r_v, r2_v, tail_v, scale_v, tmp_v, y_v;
+  __Float64x2_t Shift_v, C1_v, C2_v, C3_v, C4_v;
+#ifndef LIBMVEC_LOW_ACCURACY
+  __Float64x2_t C5_v;
+#endif
+  __Uint64x2_t ki_v, sbits_v, special;
+
+  MVEC_STATS_VECTOR (EXP2);
+
+  /* The nan propagating min and max leave nan lanes alone, inf lanes
+     end up at the bounds which give inf and 0.  Tiny and subnormal x
+     give k == 0 and a correctly rounded 1 + x*C1.  */
+  x = __builtin_aarch64_smin_nanv2df (x, (__Float64x2_t) { HI_BOUND, HI_BOUND });
+  x = __builtin_aarch64_smax_nanv2df (x, (__Float64x2_t) { LO_BOUND, LO_BOUND });
+  g = __builtin_aarch64_absv2df (x);
+  special = (__Uint64x2_t) (g > SPECIAL_BOUND);
+  MVEC_STATS_LANES (EXP2, RANGE, count_lanes_v2di (special));
+
+  /* x = k/N + r with int k.  Adding Shift rounds x to k/N and leaves k
+     in the low bits of ki, so only the table indices leave the vector
+     registers.  */
+  Shift_v = Shift;
+  kd_v = x + Shift_v;
+  ki_v = (__Uint64x2_t) kd_v;
+  kd_v -= Shift_v;
+
+  lookup_pair_v2df (&T[2 * (ki_v[0] % N)], &T[2 * (ki_v[1] % N)],
+		    &tail_v, &scale_v);
+  sbits_v = (__Uint64x2_t) scale_v + (ki_v << (52 - EXP_TABLE_BITS));
+  scale_v = (__Float64x2_t) sbits_v;
+  C1_v = C1;
+  C2_v = C2;
+  C3_v = C3;
+  C4_v = C4;
+
+  r_v = x - kd_v;
+  r2_v = r_v * r_v;
+#ifdef LIBMVEC_LOW_ACCURACY
+  tmp_v = tail_v + r_v * C1_v + r2_v * (C2_v + r_v * C3_v + r2_v * C4_v);
+#else
+  C5_v = C5;
+  tmp_v = tail_v + r_v * C1_v + r2_v * (C2_v + r_v * C3_v) + r2_v * r2_v * (C4_v + r_v * C5_v);
+#endif
+  y_v = scale_v + scale_v * tmp_v;
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    y_v = select_v2df (special,
+		       exp_specialcase_v2df (tmp_v, sbits_v,
+					     (__Uint64x2_t) (x > 0)),
+		       y_v);
+  return y_v;
+}
+
+#undef N
+#undef Shift
+#undef T
+#undef C1
+#undef C2
+#undef C3
+#undef C4
+#undef C5
+#undef HI_BOUND
+#undef LO_BOUND
+#undef SPECIAL_BOUND
+
+#endif
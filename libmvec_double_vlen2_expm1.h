@@ -0,0 +1,151 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on exp.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_DOUBLE_VLEN2_EXPM1_H
+#define _LIBMVEC_DOUBLE_VLEN2_EXPM1_H
+
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <ieee754.h>
+#include <math-narrow-eval.h>
+#include "math_config.h"
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+
+#define N (1 << EXP_TABLE_BITS)
+#define InvLn2N __exp_v2df_data.invln2N
+#define NegLn2hiN __exp_v2df_data.negln2hiN
+#define NegLn2loN __exp_v2df_data.negln2loN
+#define Shift __exp_v2df_data.shift
+#define T __exp_data.tab
+#define C2 __exp_v2df_data.poly[5 - EXP_POLY_ORDER]
+#define C3 __exp_v2df_data.poly[6 - EXP_POLY_ORDER]
+#define C4 __exp_v2df_data.poly[7 - EXP_POLY_ORDER]
+#define C5 __exp_v2df_data.poly[8 - EXP_POLY_ORDER]
+
+/* expm1(x) overflows for x > 0x1.62e42fefa39efp9 and rounds to -1 for
+   x < -0x1.2b708872320e2p5, so clamping x to [-NEG_BOUND, BOUND] keeps
+   every result while keeping k representable.  Lanes with x above
+   SPECIAL_BOUND may overflow the exponent of scale.  */
+#define BOUND 1024.0
+#define NEG_BOUND 40.0
+#define SPECIAL_BOUND 512.0
+
+/* Lanes with |x| < SMALL use the Taylor series, where scale - 1
+   would cancel.  */
+#define SMALL 0x1p-4
+
+/* expm1(x) for |x| < SMALL.  The series is cut after x^9, the first
+   omitted term is below 2^-57 relative.  */
+static __always_inline __Float64x2_t
+__expm1_small(__Float64x2_t x)
+{
+  __Float64x2_t p;
+
+  p = 0x1.71de3a556c734p-19 * x + 0x1.a01a01a01a01ap-16;
+  p = p * x + 0x1.a01a01a01a01ap-13;
+  p = p * x + 0x1.6c16c16c16c17p-10;
+  p = p * x + 0x1.1111111111111p-7;
+  p = p * x + 0x1.5555555555555p-5;
+  p = p * x + 0x1.5555555555555p-3;
+  p = p * x + 0.5;
+  p = x + x * x * p;
+  /* Keep the sign of expm1(-0).  */
+  return select_v2df ((__Uint64x2_t) (x == 0), x, p);
+}
+
+static __always_inline __Float64x2_t
+__expm1_v2df(__Float64x2_t x)
+{
+  __Float64x2_t g, z_v, scale_v, tail_v, tmp_v, r_v, r2_v, kd_v, y_v, bound_v;
+  __Float64x2_t hi_v, lo_v, one_v;
+  __Float64x2_t Shift_v, NegLn2hiN_v, NegLn2loN_v, C2_v, C3_v, C4_v, C5_v;
+  __Uint64x2_t ki_v, sbits_v, special, small;
+
+  MVEC_STATS_VECTOR (EXPM1);
+
+  g = __builtin_aarch64_absv2df (x);
+  small = (__Uint64x2_t) (g < SMALL);
+  if (!any_lane_v2di (~small))
+    return __expm1_small (x);
+
+  /* The nan propagating min and max leave nan lanes alone, inf lanes
+     end up as BOUND or -NEG_BOUND which give inf and -1.  */
+  bound_v = (__Float64x2_t) { BOUND, BOUND };
+  x = __builtin_aarch64_smin_nanv2df (x, bound_v);
+  x = __builtin_aarch64_smax_nanv2df (x, (__Float64x2_t) { -NEG_BOUND,
+							   -NEG_BOUND });
+  special = (__Uint64x2_t) (x > SPECIAL_BOUND);
+  MVEC_STATS_LANES (EXPM1, RANGE, count_lanes_v2di (special));
+
+  /* Adding Shift rounds z to k and leaves it in the low bits of ki,
+     so only the table indices leave the vector registers.  */
+  Shift_v = Shift;
+  z_v = InvLn2N * x;
+  kd_v = z_v + Shift_v;
+  ki_v = (__Uint64x2_t) kd_v;
+  kd_v -= Shift_v;
+
+  lookup_pair_v2df (&T[2 * (ki_v[0] % N)], &T[2 * (ki_v[1] % N)],
+		    &tail_v, &scale_v);
+  sbits_v = (__Uint64x2_t) scale_v + (ki_v << (52 - EXP_TABLE_BITS));
+  scale_v = (__Float64x2_t) sbits_v;
+  NegLn2hiN_v = NegLn2hiN;
+  NegLn2loN_v = NegLn2loN;
+  C2_v = C2;
+  C3_v = C3;
+  C4_v = C4;
+  C5_v = C5;
+  one_v = (__Float64x2_t) { 1.0, 1.0 };
+
+  r_v = x + kd_v * NegLn2hiN_v + kd_v * NegLn2loN_v;
+  r2_v = r_v * r_v;
+  tmp_v = tail_v + r_v + r2_v * (C2_v + r_v * C3_v) + r2_v * r2_v * (C4_v + r_v * C5_v);
+  /* scale - 1 = hi + lo exactly with the branch free two-sum, which
+     holds on both sides of scale == 1, scale*tmp is added to the low
+     part.  */
+  hi_v = scale_v - one_v;
+  lo_v = hi_v - scale_v;
+  lo_v = (scale_v - (hi_v - lo_v)) - (one_v + lo_v) + scale_v * tmp_v;
+  y_v = hi_v + lo_v;
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    y_v = select_v2df (special,
+		       exp_specialcase_v2df (tmp_v, sbits_v, special), y_v);
+  if (any_lane_v2di (small))
+    y_v = select_v2df (small, __expm1_small (x), y_v);
+  return y_v;
+}
+
+#undef N
+#undef InvLn2N
+#undef NegLn2hiN
+#undef NegLn2loN
+#undef Shift
+#undef T
+#undef C2
+#undef C3
+#undef C4
+#undef C5
+#undef BOUND
+#undef NEG_BOUND
+#undef SPECIAL_BOUND
+#undef SMALL
+
+#endif
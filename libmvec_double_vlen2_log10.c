@@ -0,0 +1,30 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libmvec_double_vlen2_log10.h"
+
+LIBMVEC_ENTRY (__Float64x2_t, _ZGVnN2v_log10, (__Float64x2_t x), (x),
+	       __log10_v2df)
+weak_alias (_ZGVnN2v_log10, _ZGVnN2v___log10_finite)
+
+__AARCH64_VECTOR_PCS_ATTR __Float64x2_t
+_ZGVnM2v_log10(__Float64x2_t x, __Uint64x2_t mask)
+{
+  return _ZGVnN2v_log10 (mask_v2df (mask, x, 1.0));
+}
+weak_alias (_ZGVnM2v_log10, _ZGVnM2v___log10_finite)
+
+LIBMVEC_ARRAY_V2DF (mvec_log10, __log10_v2df)
@@ -0,0 +1,199 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on log.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_DOUBLE_VLEN2_LOG10_H
+#define _LIBMVEC_DOUBLE_VLEN2_LOG10_H
+
+#include <stdint.h>
+#include <math.h>
+#include <float.h>
+#include <libc-symbols.h>
+#include "dla.h"
+#include "endian.h"
+#include "mpa.h"
+#include "math_config.h"
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+
+#define T __log_data.tab
+#define T2 __log_data.tab2
+#define B __log_v2df_data.poly1
+#define A __log_v2df_data.poly
+#define Ln2hi __log_v2df_data.ln2hi
+#define Ln2lo __log_v2df_data.ln2lo
+#define N (1 << LOG_TABLE_BITS)
+#define OFF 0x3fe6000000000000
+
+/* 1/ln(10) split into InvLn10hi + InvLn10lo.  */
+#define InvLn10hi __log10_invln10[0]
+#define InvLn10lo __log10_invln10[1]
+
+/* Inputs in [LO, HI) are handled by __log10_near_one.  */
+#define LO asuint64 (1.0 - 0x1p-4)
+#define HI asuint64 (1.0 + 0x1.09p-4)
+
+/* (HI + LO)/ln(10) for log(x) = HI + LO with |LO| much smaller than
+   |HI|, rounded once.  */
+static __always_inline __Float64x2_t
+__log10_scale(__Float64x2_t hi, __Float64x2_t lo)
+{
+  __Float64x2_t t, InvLn10hi_v, InvLn10lo_v;
+
+  InvLn10hi_v = InvLn10hi;
+  InvLn10lo_v = InvLn10lo;
+  t = hi * InvLn10hi_v;
+  lo = __builtin_aarch64_fmav2df (hi, InvLn10hi_v, -t)
+       + hi * InvLn10lo_v + lo * InvLn10hi_v;
+  return t + lo;
+}
+
+/* log10(x) for x close to 1.0, where the table based approximation
+   loses relative accuracy.  */
+static __always_inline __Float64x2_t
+__log10_near_one(__Float64x2_t x)
+{
+  __Float64x2_t r, r2, r3, y, w, rhi, rlo, hi, lo;
+  __Float64x2_t B0_v, B1_v, B2_v, B3_v, B4_v, B5_v;
+  __Float64x2_t B6_v, B7_v, B8_v, B9_v, B10_v;
+
+  B0_v = B[0];
+  B1_v = B[1];
+  B2_v = B[2];
+  B3_v = B[3];
+  B4_v = B[4];
+  B5_v = B[5];
+  B6_v = B[6];
+  B7_v = B[7];
+  B8_v = B[8];
+  B9_v = B[9];
+  B10_v = B[10];
+
+  r = x - 1.0;
+  r2 = r * r;
+  r3 = r * r2;
+  y = r3 * (B1_v + r * B2_v + r2 * B3_v
+	    + r3 * (B4_v + r * B5_v + r2 * B6_v
+		    + r3 * (B7_v + r * B8_v + r2 * B9_v + r3 * B10_v)));
+  w = r * 0x1p27;
+  rhi = r + w - w;
+  rlo = r - rhi;
+  w = rhi * rhi * B0_v; /* B[0] == -0.5.  */
+  hi = r + w;
+  lo = r - hi + w;
+  lo += B0_v * rlo * (rhi + r);
+  y += lo;
+  return __log10_scale (hi, y);
+}
+
+/* Results for the lanes that are not positive normal numbers:
+   log10(+-0) = -inf, log10(x < 0) = nan, log10(inf) = inf,
+   log10(nan) = nan.
+   Positive lanes keep the value computed by the caller.  */
+static __always_inline __Float64x2_t
+__log10_special(__Float64x2_t x, __Float64x2_t y)
+{
+  __Float64x2_t e;
+  __Uint64x2_t fix;
+
+  fix = (__Uint64x2_t) ~((x > 0) & (x <= DBL_MAX));
+  e = select_v2df ((__Uint64x2_t) (x == 0),
+		   (__Float64x2_t) { -INFINITY, -INFINITY }, x + x);
+  e = select_v2df ((__Uint64x2_t) (x < 0),
+		   (__Float64x2_t) { NAN, NAN }, e);
+  return select_v2df (fix, e, y);
+}
+
+static __always_inline __Float64x2_t
+__log10_v2df(__Float64x2_t x)
+{
+  __Float64x2_t r_v, r2_v, y_v, z_v, kd_v, w_v, xn;
+  __Float64x2_t hi_v, lo_v, invc_v, logc_v;
+  __Float64x2_t negone_v, Ln2hi_v, Ln2lo_v;
+  __Float64x2_t A0_v, A1_v, A2_v, A3_v, A4_v;
+  int i_0, i_1;
+  __Uint64x2_t ix_v, tmp_v, special, near1, sub, bias;
+
+  MVEC_STATS_VECTOR (LOG10);
+
+  /* Zero, negative, subnormal, inf and nan lanes.  Subnormal inputs
+     are normalized so that their exponent becomes negative and go
+     through the table code with the other lanes, the rest get their
+     result from __log10_special at the end.  */
+  special = (__Uint64x2_t) ~((x >= DBL_MIN) & (x <= DBL_MAX));
+  MVEC_STATS_LANES (LOG10, SPECIAL, count_lanes_v2di (special));
+  xn = x;
+  bias = (__Uint64x2_t) { 0, 0 };
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    {
+      sub = (__Uint64x2_t) ((x > 0) & (x < DBL_MIN));
+      xn = select_v2df (sub, x * 0x1p52, x);
+      bias = sub & (52ULL << 52);
+    }
+
+  /* x = 2^k z with z in [OFF, 2 OFF), the top bits of z - OFF select
+     the table entry.  Only the two indices leave the vector
+     registers.  */
+  ix_v = (__Uint64x2_t) xn - bias;
+  tmp_v = ix_v - OFF;
+  i_0 = (tmp_v[0] >> (52 - LOG_TABLE_BITS)) % N;
+  i_1 = (tmp_v[1] >> (52 - LOG_TABLE_BITS)) % N;
+  z_v = (__Float64x2_t) (ix_v - (tmp_v & 0xfffULL << 52));
+  kd_v = __builtin_aarch64_floatv2div2df ((__Int64x2_t) tmp_v >> 52);
+  lookup_pair_v2df (&T[i_0], &T[i_1], &invc_v, &logc_v);
+
+  negone_v = (__Float64x2_t) { -1.0, -1.0 };
+  Ln2hi_v = Ln2hi;
+  Ln2lo_v = Ln2lo;
+
+  A0_v = A[0];
+  A1_v = A[1];
+  A2_v = A[2];
+  A3_v = A[3];
+  A4_v = A[4];
+
+  r_v = __builtin_aarch64_fmav2df (z_v, invc_v, negone_v);
+  w_v = kd_v * Ln2hi_v + logc_v;
+  hi_v = w_v + r_v;
+  lo_v = w_v - hi_v + r_v + kd_v * Ln2lo_v;
+  r2_v = r_v * r_v;
+  y_v = lo_v + r2_v * A0_v + r_v * r2_v * (A1_v + r_v * A2_v + r2_v * (A3_v + r_v * A4_v));
+  y_v = __log10_scale (hi_v, y_v);
+
+  near1 = (__Uint64x2_t) ((__Uint64x2_t) x - LO < HI - LO);
+  MVEC_STATS_LANES (LOG10, NEAR_ONE, count_lanes_v2di (near1));
+  if (any_lane_v2di (near1))
+    y_v = select_v2df (near1, __log10_near_one (x), y_v);
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    return __log10_special (x, y_v);
+  return y_v;
+}
+
+#undef T
+#undef T2
+#undef B
+#undef A
+#undef Ln2hi
+#undef Ln2lo
+#undef N
+#undef OFF
+#undef InvLn10hi
+#undef InvLn10lo
+#undef LO
+#undef HI
+
+#endif
@@ -0,0 +1,181 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on log.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_DOUBLE_VLEN2_LOG1P_H
+#define _LIBMVEC_DOUBLE_VLEN2_LOG1P_H
+
+#include <stdint.h>
+#include <math.h>
+#include <float.h>
+#include <libc-symbols.h>
+#include "dla.h"
+#include "endian.h"
+#include "mpa.h"
+#include "math_config.h"
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+
+#define T __log_data.tab
+#define T2 __log_data.tab2
+#define B __log_v2df_data.poly1
+#define A __log_v2df_data.poly
+#define Ln2hi __log_v2df_data.ln2hi
+#define Ln2lo __log_v2df_data.ln2lo
+#define N (1 << LOG_TABLE_BITS)
+#define OFF 0x3fe6000000000000
+
+/* Inputs in [LO, HI) are handled by __log1p_near_zero, the same
+   interval as the near-one path of log.  */
+#define LO (-0x1p-4)
+#define HI 0x1.09p-4
+
+/* log1p(x) for x close to 0.0, with the polynomial log uses near 1.0.
+   x is the reduced argument r itself here, so no rounding error of
+   1 + x enters.  */
+static __always_inline __Float64x2_t
+__log1p_near_zero(__Float64x2_t x)
+{
+  __Float64x2_t r, r2, r3, y, w, rhi, rlo, hi, lo;
+  __Float64x2_t B0_v, B1_v, B2_v, B3_v, B4_v, B5_v;
+  __Float64x2_t B6_v, B7_v, B8_v, B9_v, B10_v;
+
+  B0_v = B[0];
+  B1_v = B[1];
+  B2_v = B[2];
+  B3_v = B[3];
+  B4_v = B[4];
+  B5_v = B[5];
+  B6_v = B[6];
+  B7_v = B[7];
+  B8_v = B[8];
+  B9_v = B[9];
+  B10_v = B[10];
+
+  r = x;
+  r2 = r * r;
+  r3 = r * r2;
+  y = r3 * (B1_v + r * B2_v + r2 * B3_v
+	    + r3 * (B4_v + r * B5_v + r2 * B6_v
+		    + r3 * (B7_v + r * B8_v + r2 * B9_v + r3 * B10_v)));
+  /* Worst-case error is around 0.507 ULP.  */
+  w = r * 0x1p27;
+  rhi = r + w - w;
+  rlo = r - rhi;
+  w = rhi * rhi * B0_v; /* B[0] == -0.5.  */
+  hi = r + w;
+  lo = r - hi + w;
+  lo += B0_v * rlo * (rhi + r);
+  y += lo;
+  y += hi;
+  /* Keep the sign of log1p(-0).  */
+  return select_v2df ((__Uint64x2_t) (x == 0), x, y);
+}
+
+/* Results for the lanes outside (-1, inf): log1p(-1) = -inf,
+   log1p(x < -1) = nan, log1p(inf) = inf, log1p(nan) = nan.  The other
+   lanes keep the value computed by the caller.  */
+static __always_inline __Float64x2_t
+__log1p_special(__Float64x2_t x, __Float64x2_t y)
+{
+  __Float64x2_t e;
+  __Uint64x2_t fix;
+
+  fix = (__Uint64x2_t) ~((x > -1.0) & (x <= DBL_MAX));
+  e = select_v2df ((__Uint64x2_t) (x == -1.0),
+		   (__Float64x2_t) { -INFINITY, -INFINITY }, x + x);
+  e = select_v2df ((__Uint64x2_t) (x < -1.0),
+		   (__Float64x2_t) { NAN, NAN }, e);
+  return select_v2df (fix, e, y);
+}
+
+static __always_inline __Float64x2_t
+__log1p_v2df(__Float64x2_t x)
+{
+  __Float64x2_t r_v, r2_v, y_v, z_v, kd_v, w_v, u_v, c_v;
+  __Float64x2_t hi_v, lo_v, invc_v, logc_v;
+  __Float64x2_t negone_v, one_v, Ln2hi_v, Ln2lo_v;
+  __Float64x2_t A0_v, A1_v, A2_v, A3_v, A4_v;
+  int i_0, i_1;
+  __Uint64x2_t ix_v, tmp_v, special, near0;
+
+  MVEC_STATS_VECTOR (LOG1P);
+
+  near0 = (__Uint64x2_t) ((x >= LO) & (x < HI));
+  if (!any_lane_v2di (~near0))
+    return __log1p_near_zero (x);
+
+  /* Lanes outside (-1, inf) get their result from __log1p_special at
+     the end, the table code below only needs to stay in bounds for
+     them.  */
+  special = (__Uint64x2_t) ~((x > -1.0) & (x <= DBL_MAX));
+  MVEC_STATS_LANES (LOG1P, SPECIAL, count_lanes_v2di (special));
+
+  /* log1p(x) = log(u) + c/u with u = 1 + x rounded and c = 1 + x - u
+     its exact rounding error.  u is a positive normal number.  */
+  one_v = (__Float64x2_t) { 1.0, 1.0 };
+  u_v = one_v + x;
+  c_v = select_v2df ((__Uint64x2_t) (x < one_v), x - (u_v - one_v),
+		     one_v - (u_v - x));
+
+  /* u = 2^k z with z in [OFF, 2 OFF), the top bits of z - OFF select
+     the table entry.  Only the two indices leave the vector
+     registers.  */
+  ix_v = (__Uint64x2_t) u_v;
+  tmp_v = ix_v - OFF;
+  i_0 = (tmp_v[0] >> (52 - LOG_TABLE_BITS)) % N;
+  i_1 = (tmp_v[1] >> (52 - LOG_TABLE_BITS)) % N;
+  z_v = (__Float64x2_t) (ix_v - (tmp_v & 0xfffULL << 52));
+  kd_v = __builtin_aarch64_floatv2div2df ((__Int64x2_t) tmp_v >> 52);
+  lookup_pair_v2df (&T[i_0], &T[i_1], &invc_v, &logc_v);
+
+  negone_v = (__Float64x2_t) { -1.0, -1.0 };
+  Ln2hi_v = Ln2hi;
+  Ln2lo_v = Ln2lo;
+
+  A0_v = A[0];
+  A1_v = A[1];
+  A2_v = A[2];
+  A3_v = A[3];
+  A4_v = A[4];
+
+  r_v = __builtin_aarch64_fmav2df (z_v, invc_v, negone_v);
+  w_v = kd_v * Ln2hi_v + logc_v;
+  hi_v = w_v + r_v;
+  lo_v = w_v - hi_v + r_v + kd_v * Ln2lo_v + c_v / u_v;
+  r2_v = r_v * r_v;
+  y_v = lo_v + r2_v * A0_v + r_v * r2_v * (A1_v + r_v * A2_v + r2_v * (A3_v + r_v * A4_v)) + hi_v;
+
+  if (any_lane_v2di (near0))
+    y_v = select_v2df (near0, __log1p_near_zero (x), y_v);
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    return __log1p_special (x, y_v);
+  return y_v;
+}
+
+#undef T
+#undef T2
+#undef B
+#undef A
+#undef Ln2hi
+#undef Ln2lo
+#undef N
+#undef OFF
+#undef LO
+#undef HI
+
+#endif
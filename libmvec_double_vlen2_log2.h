@@ -0,0 +1,250 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on log2.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_DOUBLE_VLEN2_LOG2_H
+#define _LIBMVEC_DOUBLE_VLEN2_LOG2_H
+
+#include <math.h>
+#include <float.h>
+#include <math_private.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <libc-symbols.h>
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+#include "math_config.h"
+
+#define T __log2_data.tab
+#define T2 __log2_data.tab2
+#define B __log2_v2df_data.poly1
+#define A __log2_v2df_data.poly
+#define InvLn2hi __log2_v2df_data.invln2hi
+#define InvLn2lo __log2_v2df_data.invln2lo
+#define N (1 << LOG2_TABLE_BITS)
+#define OFF 0x3fe6000000000000
+
+/* Inputs in [LO, HI) are handled by __log2_near_one.  */
+#define LO asuint64 (1.0 - 0x1.5b51p-5)
+#define HI asuint64 (1.0 + 0x1.6ab2p-5)
+
+#ifdef LIBMVEC_LOW_ACCURACY
+/* log2(1+r) - r/Ln2 ~= r^2 * (A0 + r*A1 + r^2*A2 + r^3*A3 + r^4*A4)
+   for |r| <= 0x1.fdp-8, absolute error 2^-56.5.  */
+# define A0 __log2_poly_low[0]
+# define A1 __log2_poly_low[1]
+# define A2 __log2_poly_low[2]
+# define A3 __log2_poly_low[3]
+# define A4 __log2_poly_low[4]
+
+/* log2(1+r) - r/Ln2 ~= r^2 * P(r) for |r| <= 0x1.6ab2p-5, relative
+   error 2^-51.7.  */
+# define NP0 __log2_near_one_poly_low[0]
+# define NP1 __log2_near_one_poly_low[1]
+# define NP2 __log2_near_one_poly_low[2]
+# define NP3 __log2_near_one_poly_low[3]
+# define NP4 __log2_near_one_poly_low[4]
+# define NP5 __log2_near_one_poly_low[5]
+# define NP6 __log2_near_one_poly_low[6]
+# define NP7 __log2_near_one_poly_low[7]
+
+/* log2(x) for x close to 1.0, with a shorter polynomial and without
+   the hi/lo split of the default variant.  */
+static __always_inline __Float64x2_t
+__log2_near_one(__Float64x2_t x)
+{
+  __Float64x2_t r, p;
+
+  r = x - 1.0;
+  p = r * NP7 + NP6;
+  p = r * p + NP5;
+  p = r * p + NP4;
+  p = r * p + NP3;
+  p = r * p + NP2;
+  p = r * p + NP1;
+  p = r * p + NP0;
+  p = r * r * p + r * InvLn2lo;
+  return __builtin_aarch64_fmav2df (r, InvLn2hi, p);
+}
+#else
+# define A0 A[0]
+# define A1 A[1]
+# define A2 A[2]
+# define A3 A[3]
+# define A4 A[4]
+# define A5 A[5]
+
+/* log2(x) for x close to 1.0, where the table based approximation
+   loses relative accuracy.  */
+static __always_inline __Float64x2_t
+__log2_near_one(__Float64x2_t x)
+{
+  __Float64x2_t r, r2, r4, y, p, hi, lo;
+  __Float64x2_t InvLn2hi_v, InvLn2lo_v;
+  __Float64x2_t B0_v, B1_v, B2_v, B3_v, B4_v;
+  __Float64x2_t B5_v, B6_v, B7_v, B8_v, B9_v;
+
+  InvLn2hi_v = InvLn2hi;
+  InvLn2lo_v = InvLn2lo;
+  B0_v = B[0];
+  B1_v = B[1];
+  B2_v = B[2];
+  B3_v = B[3];
+  B4_v = B[4];
+  B5_v = B[5];
+  B6_v = B[6];
+  B7_v = B[7];
+  B8_v = B[8];
+  B9_v = B[9];
+
+  r = x - 1.0;
+  hi = r * InvLn2hi_v;
+  lo = r * InvLn2lo_v + __builtin_aarch64_fmav2df (r, InvLn2hi_v, -hi);
+  r2 = r * r; /* rounding error: 0x1p-62.  */
+  r4 = r2 * r2;
+  /* Worst-case error is less than 0.54 ULP.  */
+  p = r2 * (B0_v + r * B1_v);
+  y = hi + p;
+  lo += hi - y + p;
+  lo += r4 * (B2_v + r * B3_v + r2 * (B4_v + r * B5_v)
+	      + r4 * (B6_v + r * B7_v + r2 * (B8_v + r * B9_v)));
+  y += lo;
+  return y;
+}
+#endif
+
+/* Results for the lanes that are not positive normal numbers:
+   log2(+-0) = -inf, log2(x < 0) = nan, log2(inf) = inf,
+   log2(nan) = nan.  Positive lanes keep the value computed by the
+   caller.  */
+static __always_inline __Float64x2_t
+__log2_special(__Float64x2_t x, __Float64x2_t y)
+{
+  __Float64x2_t e;
+  __Uint64x2_t fix;
+
+  fix = (__Uint64x2_t) ~((x > 0) & (x <= DBL_MAX));
+  e = select_v2df ((__Uint64x2_t) (x == 0),
+		   (__Float64x2_t) { -INFINITY, -INFINITY }, x + x);
+  e = select_v2df ((__Uint64x2_t) (x < 0),
+		   (__Float64x2_t) { NAN, NAN }, e);
+  return select_v2df (fix, e, y);
+}
+
+static __always_inline __Float64x2_t
+__log2_v2df(__Float64x2_t x)
+{
+  __Float64x2_t r_v, r2_v, r4_v, p_v, y_v, z_v, kd_v, xn;
+  __Float64x2_t hi_v, lo_v, invc_v, logc_v;
+  __Float64x2_t negone_v;
+  __Float64x2_t A0_v, A1_v, A2_v, A3_v, A4_v;
+#ifndef LIBMVEC_LOW_ACCURACY
+  __Float64x2_t A5_v;
+#endif
+  __Float64x2_t InvLn2hi_v, InvLn2lo_v, t1_v, t2_v, t3_v;
+  int i_0, i_1;
+  __Uint64x2_t ix_v, tmp_v, special, near1, sub, bias;
+
+  MVEC_STATS_VECTOR (LOG2);
+
+  /* Zero, negative, subnormal, inf and nan lanes.  Subnormal inputs
+     are normalized so that their exponent becomes negative and go
+     through the table code with the other lanes, the rest get their
+     result from __log2_special at the end.  */
+  special = (__Uint64x2_t) ~((x >= DBL_MIN) & (x <= DBL_MAX));
+  MVEC_STATS_LANES (LOG2, SPECIAL, count_lanes_v2di (special));
+  xn = x;
+  bias = (__Uint64x2_t) { 0, 0 };
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    {
+      sub = (__Uint64x2_t) ((x > 0) & (x < DBL_MIN));
+      xn = select_v2df (sub, x * 0x1p52, x);
+      bias = sub & (52ULL << 52);
+    }
+
+  /* x = 2^k z with z in [OFF, 2 OFF), the top bits of z - OFF select
+     the table entry.  Only the two indices leave the vector
+     registers.  */
+  ix_v = (__Uint64x2_t) xn - bias;
+  tmp_v = ix_v - OFF;
+  i_0 = (tmp_v[0] >> (52 - LOG2_TABLE_BITS)) % N;
+  i_1 = (tmp_v[1] >> (52 - LOG2_TABLE_BITS)) % N;
+  z_v = (__Float64x2_t) (ix_v - (tmp_v & 0xfffULL << 52));
+  kd_v = __builtin_aarch64_floatv2div2df ((__Int64x2_t) tmp_v >> 52);
+  lookup_pair_v2df (&T[i_0], &T[i_1], &invc_v, &logc_v);
+
+  negone_v = (__Float64x2_t) { -1.0, -1.0 };
+  InvLn2hi_v = InvLn2hi;
+  InvLn2lo_v = InvLn2lo;
+
+  A0_v = A0;
+  A1_v = A1;
+  A2_v = A2;
+  A3_v = A3;
+  A4_v = A4;
+
+  r_v = __builtin_aarch64_fmav2df (z_v, invc_v, negone_v);
+  t1_v = r_v * InvLn2hi_v;
+  t2_v = r_v * InvLn2lo_v + __builtin_aarch64_fmav2df (r_v, InvLn2hi_v, -t1_v);
+  t3_v = kd_v + logc_v;
+  hi_v = t3_v + t1_v;
+  lo_v = t3_v - hi_v + t1_v + t2_v;
+  r2_v = r_v * r_v;
+  r4_v = r2_v * r2_v;
+#ifdef LIBMVEC_LOW_ACCURACY
+  p_v = A0_v + r_v * A1_v + r2_v * (A2_v + r_v * A3_v) + r4_v * A4_v;
+#else
+  A5_v = A5;
+  p_v = A0_v + r_v * A1_v + r2_v * (A2_v + r_v * A3_v) + r4_v * (A4_v + r_v * A5_v);
+#endif
+  y_v = lo_v + r2_v * p_v + hi_v;
+
+  near1 = (__Uint64x2_t) ((__Uint64x2_t) x - LO < HI - LO);
+  MVEC_STATS_LANES (LOG2, NEAR_ONE, count_lanes_v2di (near1));
+  if (any_lane_v2di (near1))
+    y_v = select_v2df (near1, __log2_near_one (x), y_v);
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    return __log2_special (x, y_v);
+  return y_v;
+}
+
+#undef T
+#undef T2
+#undef B
+#undef A
+#undef InvLn2hi
+#undef InvLn2lo
+#undef N
+#undef OFF
+#undef LO
+#undef HI
+#undef A0
+#undef A1
+#undef A2
+#undef A3
+#undef A4
+#undef NP0
+#undef NP1
+#undef NP2
+#undef NP3
+#undef NP4
+#undef NP5
+#undef NP6
+#undef NP7
+#undef A5
+
+#endif
@@ -0,0 +1,245 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on pow.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_DOUBLE_VLEN2_POW_H
+#define _LIBMVEC_DOUBLE_VLEN2_POW_H
+
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+
+#define T __pow_log_data.tab
+#define A __pow_log_v2df_data.poly
+#define Ln2hi __pow_log_v2df_data.ln2hi
+#define Ln2lo __pow_log_v2df_data.ln2lo
+#define N (1 << POW_LOG_TABLE_BITS)
+#define OFF 0x3fe6955500000000
+
+#define N_EXP (1 << EXP_TABLE_BITS)
+#define InvLn2N __exp_v2df_data.invln2N
+#define NegLn2hiN __exp_v2df_data.negln2hiN
+#define NegLn2loN __exp_v2df_data.negln2loN
+#define Shift __exp_v2df_data.shift
+#define T_EXP __exp_data.tab
+#define C2 __exp_v2df_data.poly[5 - EXP_POLY_ORDER]
+#define C3 __exp_v2df_data.poly[6 - EXP_POLY_ORDER]
+#define C4 __exp_v2df_data.poly[7 - EXP_POLY_ORDER]
+#define C5 __exp_v2df_data.poly[8 - EXP_POLY_ORDER]
+
+/* Same bounds as in _ZGVnN2v_exp: exp(+-BOUND) overflows or
+   underflows to zero, lanes above SPECIAL_BOUND may overflow or
+   underflow the exponent of scale.  */
+#define BOUND 1024.0
+#define SPECIAL_BOUND 512.0
+
+/* log(x) for the positive normal numbers with the bits IX, returned
+   as the sum of the result and *TAIL with about 68 bits of
+   precision.  */
+static __always_inline __Float64x2_t
+__pow_log(__Uint64x2_t ix, __Float64x2_t *tail)
+{
+  __Float64x2_t z, r, kd, invc, logc, logctail, negone;
+  __Float64x2_t t1, t2, lo1, lo2, lo3, lo4, ar, ar2, ar3, p, hi, lo, y;
+  __Float64x2_t Ln2hi_v, Ln2lo_v;
+  __Float64x2_t A0_v, A1_v, A2_v, A3_v, A4_v, A5_v, A6_v;
+  __Uint64x2_t tmp, iz;
+  int i_0, i_1;
+
+  tmp = ix - OFF;
+  i_0 = (tmp[0] >> (52 - POW_LOG_TABLE_BITS)) % N;
+  i_1 = (tmp[1] >> (52 - POW_LOG_TABLE_BITS)) % N;
+  iz = ix - (tmp & (0xfffULL << 52));
+  z = (__Float64x2_t) iz;
+
+  kd = __builtin_aarch64_floatv2div2df ((__Int64x2_t) tmp >> 52);
+  invc = (__Float64x2_t) { T[i_0].invc, T[i_1].invc };
+  lookup_pair_v2df (&T[i_0].logc, &T[i_1].logc, &logc, &logctail);
+  negone = (__Float64x2_t) { -1.0, -1.0 };
+  Ln2hi_v = Ln2hi;
+  Ln2lo_v = Ln2lo;
+
+  A0_v = A[0];
+  A1_v = A[1];
+  A2_v = A[2];
+  A3_v = A[3];
+  A4_v = A[4];
+  A5_v = A[5];
+  A6_v = A[6];
+
+  /* 1/c is j/N or j/N/2 where j is an integer in [N,2N) and
+     |z/c - 1| < 1/N, so r = z/c - 1 is exactly representable.  */
+  r = __builtin_aarch64_fmav2df (z, invc, negone);
+
+  /* k*Ln2 + log(c) + r.  */
+  t1 = kd * Ln2hi_v + logc;
+  t2 = t1 + r;
+  lo1 = kd * Ln2lo_v + logctail;
+  lo2 = t1 - t2 + r;
+
+  /* k*Ln2 + log(c) + r + A[0]*r*r.  */
+  ar = A0_v * r; /* A[0] == -0.5.  */
+  ar2 = r * ar;
+  ar3 = r * ar2;
+  hi = t2 + ar2;
+  lo3 = __builtin_aarch64_fmav2df (ar, r, -ar2);
+  lo4 = t2 - hi + ar2;
+
+  /* p = log1p(r) - r - A[0]*r*r.  */
+  p = ar3 * (A1_v + r * A2_v + ar2 * (A3_v + r * A4_v
+				      + ar2 * (A5_v + r * A6_v)));
+  lo = lo1 + lo2 + lo3 + lo4 + p;
+  y = hi + lo;
+  *tail = hi - y + lo;
+  return y;
+}
+
+/* exp(x + xtail) where |xtail| is tiny compared to |x|.  The result
+   is always positive, overflows to inf and underflows to subnormals
+   and zero.  */
+static __always_inline __Float64x2_t
+__pow_exp(__Float64x2_t x, __Float64x2_t xtail)
+{
+  __Float64x2_t z_v, scale_v, tail_v, tmp_v, r_v, r2_v, kd_v, y_v, bound_v;
+  __Float64x2_t Shift_v, NegLn2hiN_v, NegLn2loN_v, C2_v, C3_v, C4_v, C5_v;
+  __Uint64x2_t ki_v, sbits_v, special;
+
+  /* Once x is clamped the tail no longer belongs to it.  */
+  bound_v = (__Float64x2_t) { BOUND, BOUND };
+  xtail = select_v2df ((__Uint64x2_t) (__builtin_aarch64_absv2df (x) > BOUND),
+		       (__Float64x2_t) { 0.0, 0.0 }, xtail);
+  x = __builtin_aarch64_smin_nanv2df (x, bound_v);
+  x = __builtin_aarch64_smax_nanv2df (x, -bound_v);
+  special = (__Uint64x2_t) (__builtin_aarch64_absv2df (x) > SPECIAL_BOUND);
+  MVEC_STATS_LANES (POW, RANGE, count_lanes_v2di (special));
+
+  /* Adding Shift rounds z to k and leaves it in the low bits of ki,
+     so only the table indices leave the vector registers.  */
+  Shift_v = Shift;
+  z_v = InvLn2N * x;
+  kd_v = z_v + Shift_v;
+  ki_v = (__Uint64x2_t) kd_v;
+  kd_v -= Shift_v;
+
+  lookup_pair_v2df (&T_EXP[2 * (ki_v[0] % N_EXP)],
+		    &T_EXP[2 * (ki_v[1] % N_EXP)], &tail_v, &scale_v);
+  sbits_v = (__Uint64x2_t) scale_v + (ki_v << (52 - EXP_TABLE_BITS));
+  scale_v = (__Float64x2_t) sbits_v;
+  NegLn2hiN_v = NegLn2hiN;
+  NegLn2loN_v = NegLn2loN;
+  C2_v = C2;
+  C3_v = C3;
+  C4_v = C4;
+  C5_v = C5;
+
+  r_v = x + kd_v * NegLn2hiN_v + kd_v * NegLn2loN_v;
+  /* The code assumes 2^-200 < |xtail| < 2^-8/N.  */
+  r_v += xtail;
+  r2_v = r_v * r_v;
+  tmp_v = tail_v + r_v + r2_v * (C2_v + r_v * C3_v) + r2_v * r2_v * (C4_v + r_v * C5_v);
+  y_v = scale_v + scale_v * tmp_v;
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    y_v = select_v2df (special,
+		       exp_specialcase_v2df (tmp_v, sbits_v,
+					     (__Uint64x2_t) (x > 0)),
+		       y_v);
+  return y_v;
+}
+
+__AARCH64_VECTOR_PCS_ATTR static __Float64x2_t
+__scalar_pow(__Float64x2_t x, __Float64x2_t y, __Float64x2_t r,
+	     __Uint64x2_t special)
+{
+  return fixup2_v2df (pow, x, y, r, special);
+}
+
+static __always_inline __Float64x2_t
+__pow_v2df(__Float64x2_t x, __Float64x2_t y)
+{
+  __Float64x2_t ax, ys, yt, yh, hi, lo, ehi, elo, r, one;
+  __Uint64x2_t special, neg, yint, invalid, sign, sub, ix;
+
+  MVEC_STATS_VECTOR (POW);
+
+  /* Lanes where x is zero, inf or nan or y is inf or nan are
+     recomputed by __scalar_pow.  They are replaced by 1^1 in the
+     vector evaluation.  Every other lane, including negative and
+     subnormal x and any finite y, is computed here.  */
+  one = (__Float64x2_t) { 1.0, 1.0 };
+  ax = __builtin_aarch64_absv2df (x);
+  special = (__Uint64x2_t) ~((ax > 0) & (ax <= DBL_MAX)
+			     & (__builtin_aarch64_absv2df (y) <= DBL_MAX));
+  MVEC_STATS_LANES (POW, SPECIAL, count_lanes_v2di (special));
+  ax = select_v2df (special, one, ax);
+  ys = select_v2df (special, one, y);
+
+  /* pow(x, y) = +-pow(|x|, y) for x < 0 and integer y, with the sign
+     of x when y is odd, and nan when y is not an integer.  Every y
+     with |y| >= 2^53 is an even integer.  */
+  neg = (__Uint64x2_t) (x < 0);
+  yt = __builtin_aarch64_btruncv2df (ys);
+  yh = ys * 0.5;
+  yint = (__Uint64x2_t) (yt == ys);
+  invalid = neg & ~yint;
+  sign = neg & yint & (__Uint64x2_t) (__builtin_aarch64_btruncv2df (yh) != yh)
+	 & (1ULL << 63);
+
+  /* Normalize subnormal x, the exponent bias is taken off again in
+     the bits fed to __pow_log.  */
+  ix = (__Uint64x2_t) ax;
+  sub = (__Uint64x2_t) (ax < DBL_MIN);
+  if (__glibc_unlikely (any_lane_v2di (sub)))
+    ix = (__Uint64x2_t) select_v2df (sub, ax * 0x1p52, ax)
+	 - (sub & (52ULL << 52));
+
+  /* y*log(x) as ehi + elo, then exp of the sum.  */
+  hi = __pow_log (ix, &lo);
+  ehi = ys * hi;
+  elo = ys * lo + __builtin_aarch64_fmav2df (ys, hi, -ehi);
+  r = __pow_exp (ehi, elo);
+  r = (__Float64x2_t) ((__Uint64x2_t) r | sign);
+
+  if (__glibc_unlikely (any_lane_v2di (invalid)))
+    r = select_v2df (invalid, (__Float64x2_t) { NAN, NAN }, r);
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    return __scalar_pow (x, y, r, special);
+  return r;
+}
+
+#undef T
+#undef A
+#undef Ln2hi
+#undef Ln2lo
+#undef N
+#undef OFF
+#undef N_EXP
+#undef InvLn2N
+#undef NegLn2hiN
+#undef NegLn2loN
+#undef Shift
+#undef T_EXP
+#undef C2
+#undef C3
+#undef C4
+#undef C5
+#undef BOUND
+#undef SPECIAL_BOUND
+
+#endif
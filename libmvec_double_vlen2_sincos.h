@@ -0,0 +1,195 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _LIBMVEC_DOUBLE_VLEN2_SINCOS_H
+#define _LIBMVEC_DOUBLE_VLEN2_SINCOS_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "endian.h"
+#include "libmvec_double_sinetable.h"
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+#include "libmvec_double_sinekernel.h"
+
+//
+// main body of routine
+//
+
+__AARCH64_VECTOR_PCS_ATTR
+static inline __Float64x2_t _sine_kernel(__Float64x2_t x, double *tbl, int sym)
+{
+  __Float64x2_t a, x0, r1, k;
+  int sign_0, sign_1;
+  unsigned int tablebase_0, tablebase_1;
+
+  sign_0 = x[0] > 0 ? 0 : 1;
+  sign_1 = x[1] > 0 ? 0 : 1;
+
+  a = __builtin_aarch64_absv2df (x);
+  k = _sine_reduce (a, &x0, &r1);
+  tablebase_0 = (unsigned int) k[0];
+  tablebase_1 = (unsigned int) k[1];
+
+  if (sign_0)
+    tablebase_0 += sym;
+  if (sign_1)
+    tablebase_1 += sym;
+
+  tablebase_0 = (tablebase_0 << 2) & 0x7c;
+  tablebase_1 = (tablebase_1 << 2) & 0x7c;
+  return _sine_eval (x0, r1, tbl, tablebase_0, tablebase_1);
+}
+
+//
+// sine entry point
+//
+
+static __always_inline
+__Float64x2_t __sin_v2df(__Float64x2_t x)
+{
+__Float64x2_t result, c, xs;
+__Uint64x2_t special;
+double *ptr;
+int sym;
+
+  MVEC_STATS_VECTOR (SIN);
+
+  c = __builtin_aarch64_absv2df (x);
+
+  /* inf and nan lanes are fed to the kernel as zero and give nan.  */
+  special = (__Uint64x2_t) ~(c < INFINITY);
+  MVEC_STATS_LANES (SIN, SPECIAL, count_lanes_v2di (special));
+  MVEC_STATS_LANES (SIN, RANGE,
+		    count_lanes_v2di ((__Uint64x2_t) (c > CUTOFF) & ~special));
+  xs = select_v2df (special, (__Float64x2_t) { 0.0, 0.0 }, x);
+
+  ptr = (double *)_sin_table;
+  sym = 1<<4;
+  result = _sine_kernel(xs,ptr,sym);
+  /* _sine_kernel returns +0 for sin(-0).  */
+  result = select_v2df ((__Uint64x2_t) (x == 0), x, result);
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    result = select_v2df (special, x - x, result);
+  return (result);
+}
+
+//
+// cosine entry point
+//
+
+static __always_inline
+__Float64x2_t __cos_v2df(__Float64x2_t x)
+{
+__Float64x2_t result, c, xs;
+__Uint64x2_t special;
+double *ptr;
+int sym;
+
+  MVEC_STATS_VECTOR (COS);
+
+  c = __builtin_aarch64_absv2df (x);
+
+  /* inf and nan lanes are fed to the kernel as zero and give nan.  */
+  special = (__Uint64x2_t) ~(c < INFINITY);
+  MVEC_STATS_LANES (COS, SPECIAL, count_lanes_v2di (special));
+  MVEC_STATS_LANES (COS, RANGE,
+		    count_lanes_v2di ((__Uint64x2_t) (c > CUTOFF) & ~special));
+  xs = select_v2df (special, (__Float64x2_t) { 0.0, 0.0 }, x);
+
+  ptr = (double *)_cos_table;
+  sym = 0;
+  result = _sine_kernel(xs,ptr,sym);
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    result = select_v2df (special, x - x, result);
+  return (result);
+}
+
+//
+// sincos entry point
+//
+
+/* One reduction feeds both results.  The sine and cosine table entries
+   use different reference points, so each still does its own lookup
+   and polynomial pair.  */
+static __always_inline
+void __sincos_v2df(__Float64x2_t x, __Float64x2_t *sinp, __Float64x2_t *cosp)
+{
+__Float64x2_t s, c, a, xs, x0, r1, k;
+__Uint64x2_t special;
+unsigned int tablebase_0, tablebase_1, sinbase_0, sinbase_1;
+
+  MVEC_STATS_VECTOR (SINCOS);
+
+  a = __builtin_aarch64_absv2df (x);
+
+  /* inf and nan lanes are fed to the kernel as zero and give nan.  */
+  special = (__Uint64x2_t) ~(a < INFINITY);
+  MVEC_STATS_LANES (SINCOS, SPECIAL, count_lanes_v2di (special));
+  MVEC_STATS_LANES (SINCOS, RANGE,
+		    count_lanes_v2di ((__Uint64x2_t) (a > CUTOFF) & ~special));
+  xs = select_v2df (special, (__Float64x2_t) { 0.0, 0.0 }, a);
+
+  k = _sine_reduce (xs, &x0, &r1);
+  tablebase_0 = (unsigned int) k[0];
+  tablebase_1 = (unsigned int) k[1];
+  sinbase_0 = tablebase_0;
+  sinbase_1 = tablebase_1;
+  if (!(x[0] > 0))
+    sinbase_0 += 1<<4;
+  if (!(x[1] > 0))
+    sinbase_1 += 1<<4;
+
+  s = _sine_eval (x0, r1, (double *)_sin_table,
+		  (sinbase_0 << 2) & 0x7c, (sinbase_1 << 2) & 0x7c);
+  c = _sine_eval (x0, r1, (double *)_cos_table,
+		  (tablebase_0 << 2) & 0x7c, (tablebase_1 << 2) & 0x7c);
+  /* _sine_eval returns +0 for sin(-0).  */
+  s = select_v2df ((__Uint64x2_t) (x == 0), x, s);
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    {
+      s = select_v2df (special, x - x, s);
+      c = select_v2df (special, x - x, c);
+    }
+  *sinp = s;
+  *cosp = c;
+}
+
+static __always_inline
+void __sincos_l8l8(__Float64x2_t x, double *sinp, double *cosp)
+{
+__Float64x2_t s, c;
+
+  __sincos_v2df(x, &s, &c);
+  __builtin_memcpy (sinp, &s, sizeof (s));
+  __builtin_memcpy (cosp, &c, sizeof (c));
+}
+
+/* As above with a vector of destination pointers per result.  */
+static __always_inline
+void __sincos_vvv(__Float64x2_t x, __Uint64x2_t sinp, __Uint64x2_t cosp)
+{
+__Float64x2_t s, c;
+
+  __sincos_v2df(x, &s, &c);
+  *(double *) sinp[0] = s[0];
+  *(double *) sinp[1] = s[1];
+  *(double *) cosp[0] = c[0];
+  *(double *) cosp[1] = c[1];
+}
+
+#endif
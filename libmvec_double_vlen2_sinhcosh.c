@@ -0,0 +1,54 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libmvec_double_vlen2_sinhcosh.h"
+
+LIBMVEC_ENTRY (__Float64x2_t, _ZGVnN2v_sinh, (__Float64x2_t x), (x),
+	       __sinh_v2df)
+weak_alias (_ZGVnN2v_sinh, _ZGVnN2v___sinh_finite)
+
+__AARCH64_VECTOR_PCS_ATTR __Float64x2_t
+_ZGVnM2v_sinh(__Float64x2_t x, __Uint64x2_t mask)
+{
+  return _ZGVnN2v_sinh (mask_v2df (mask, x, 0.0));
+}
+weak_alias (_ZGVnM2v_sinh, _ZGVnM2v___sinh_finite)
+
+LIBMVEC_ENTRY (__Float64x2_t, _ZGVnN2v_cosh, (__Float64x2_t x), (x),
+	       __cosh_v2df)
+weak_alias (_ZGVnN2v_cosh, _ZGVnN2v___cosh_finite)
+
+__AARCH64_VECTOR_PCS_ATTR __Float64x2_t
+_ZGVnM2v_cosh(__Float64x2_t x, __Uint64x2_t mask)
+{
+  return _ZGVnN2v_cosh (mask_v2df (mask, x, 0.0));
+}
+weak_alias (_ZGVnM2v_cosh, _ZGVnM2v___cosh_finite)
+
+LIBMVEC_ENTRY (__Float64x2_t, _ZGVnN2v_tanh, (__Float64x2_t x), (x),
+	       __tanh_v2df)
+weak_alias (_ZGVnN2v_tanh, _ZGVnN2v___tanh_finite)
+
+__AARCH64_VECTOR_PCS_ATTR __Float64x2_t
+_ZGVnM2v_tanh(__Float64x2_t x, __Uint64x2_t mask)
+{
+  return _ZGVnN2v_tanh (mask_v2df (mask, x, 0.0));
+}
+weak_alias (_ZGVnM2v_tanh, _ZGVnM2v___tanh_finite)
+
+LIBMVEC_ARRAY_V2DF (mvec_sinh, __sinh_v2df)
+LIBMVEC_ARRAY_V2DF (mvec_cosh, __cosh_v2df)
+LIBMVEC_ARRAY_V2DF (mvec_tanh, __tanh_v2df)
@@ -0,0 +1,237 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on exp.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_DOUBLE_VLEN2_SINHCOSH_H
+#define _LIBMVEC_DOUBLE_VLEN2_SINHCOSH_H
+
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <ieee754.h>
+#include <math-narrow-eval.h>
+#include "math_config.h"
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+
+#define N (1 << EXP_TABLE_BITS)
+#define InvLn2N __exp_v2df_data.invln2N
+#define NegLn2hiN __exp_v2df_data.negln2hiN
+#define NegLn2loN __exp_v2df_data.negln2loN
+#define Shift __exp_v2df_data.shift
+#define T __exp_data.tab
+#define C2 __exp_v2df_data.poly[5 - EXP_POLY_ORDER]
+#define C3 __exp_v2df_data.poly[6 - EXP_POLY_ORDER]
+#define C4 __exp_v2df_data.poly[7 - EXP_POLY_ORDER]
+#define C5 __exp_v2df_data.poly[8 - EXP_POLY_ORDER]
+
+/* sinh(x) and cosh(x) overflow for |x| > 0x1.633ce8fb9f87dp9, so
+   clamping |x| to BOUND keeps every result while keeping k
+   representable.  Lanes with |x| above SPECIAL_BOUND may overflow the
+   exponent of scale.  tanh(x) rounds to +-1 for |x| > 0x1.30fc1931f09cap4
+   and |x| is clamped to TANH_BOUND.  */
+#define BOUND 1024.0
+#define SPECIAL_BOUND 512.0
+#define TANH_BOUND 20.0
+
+/* Lanes with |x| < SMALL use the Taylor series of expm1, where
+   scale - 1 would cancel.  */
+#define SMALL 0x1p-4
+
+/* expm1(x) for 0 <= x < SMALL, as in libmvec_double_vlen2_expm1.h.  */
+static __always_inline __Float64x2_t
+__sinh_expm1_small(__Float64x2_t x)
+{
+  __Float64x2_t p;
+
+  p = 0x1.71de3a556c734p-19 * x + 0x1.a01a01a01a01ap-16;
+  p = p * x + 0x1.a01a01a01a01ap-13;
+  p = p * x + 0x1.6c16c16c16c17p-10;
+  p = p * x + 0x1.1111111111111p-7;
+  p = p * x + 0x1.5555555555555p-5;
+  p = p * x + 0x1.5555555555555p-3;
+  p = p * x + 0.5;
+  return x + x * x * p;
+}
+
+/* The table reduction of exp for 0 <= A <= BOUND: exp(A) is
+   scale * (1 + *TMPP), where scale is returned and *SBITSP holds its
+   bits.  The exponent of scale may have overflowed in the lanes with
+   A > SPECIAL_BOUND, exp_specialcase_v2df handles those.  */
+static __always_inline __Float64x2_t
+__sinh_exp_reduce(__Float64x2_t a, __Float64x2_t *tmpp, __Uint64x2_t *sbitsp)
+{
+  __Float64x2_t z_v, scale_v, tail_v, r_v, r2_v, kd_v;
+  __Float64x2_t Shift_v, NegLn2hiN_v, NegLn2loN_v, C2_v, C3_v, C4_v, C5_v;
+  __Uint64x2_t ki_v, sbits_v;
+
+  /* Adding Shift rounds z to k and leaves it in the low bits of ki,
+     so only the table indices leave the vector registers.  */
+  Shift_v = Shift;
+  z_v = InvLn2N * a;
+  kd_v = z_v + Shift_v;
+  ki_v = (__Uint64x2_t) kd_v;
+  kd_v -= Shift_v;
+
+  lookup_pair_v2df (&T[2 * (ki_v[0] % N)], &T[2 * (ki_v[1] % N)],
+		    &tail_v, &scale_v);
+  sbits_v = (__Uint64x2_t) scale_v + (ki_v << (52 - EXP_TABLE_BITS));
+  NegLn2hiN_v = NegLn2hiN;
+  NegLn2loN_v = NegLn2loN;
+  C2_v = C2;
+  C3_v = C3;
+  C4_v = C4;
+  C5_v = C5;
+
+  r_v = a + kd_v * NegLn2hiN_v + kd_v * NegLn2loN_v;
+  r2_v = r_v * r_v;
+  *tmpp = tail_v + r_v + r2_v * (C2_v + r_v * C3_v) + r2_v * r2_v * (C4_v + r_v * C5_v);
+  *sbitsp = sbits_v;
+  return (__Float64x2_t) sbits_v;
+}
+
+/* expm1(A) for 0 <= A <= SPECIAL_BOUND from the reduction above, with
+   the series in the lanes below SMALL.  */
+static __always_inline __Float64x2_t
+__sinh_expm1(__Float64x2_t a, __Float64x2_t scale, __Float64x2_t tmp)
+{
+  __Float64x2_t hi, lo, one, y;
+  __Uint64x2_t small;
+
+  one = (__Float64x2_t) { 1.0, 1.0 };
+  /* scale - 1 = hi + lo exactly, scale*tmp is added to the low part.  */
+  hi = scale - one;
+  lo = scale - (hi + one) + scale * tmp;
+  y = hi + lo;
+  small = (__Uint64x2_t) (a < SMALL);
+  if (any_lane_v2di (small))
+    y = select_v2df (small, __sinh_expm1_small (a), y);
+  return y;
+}
+
+/* Set the sign of the nonnegative R to the sign of X.  */
+static __always_inline __Float64x2_t
+__sinh_copysign(__Float64x2_t r, __Float64x2_t x)
+{
+  __Uint64x2_t sign = (__Uint64x2_t) x & 0x8000000000000000;
+
+  return (__Float64x2_t) ((__Uint64x2_t) r | sign);
+}
+
+//
+// hyperbolic sine entry point
+//
+
+/* sinh(a) = (e + e/(e + 1))/2 with e = expm1(a), a sum of two
+   nonnegative terms.  Where exp(a) may overflow, sinh(a) = exp(a)/2
+   with the halving folded into the exponent of scale.  */
+static __always_inline __Float64x2_t
+__sinh_v2df(__Float64x2_t x)
+{
+  __Float64x2_t a, scale, tmp, e, y;
+  __Uint64x2_t sbits, special;
+
+  MVEC_STATS_VECTOR (SINH);
+
+  /* The nan propagating min leaves nan lanes alone, inf lanes end up
+     as BOUND which gives inf.  */
+  a = __builtin_aarch64_absv2df (x);
+  a = __builtin_aarch64_smin_nanv2df (a, (__Float64x2_t) { BOUND, BOUND });
+  special = (__Uint64x2_t) (a > SPECIAL_BOUND);
+  MVEC_STATS_LANES (SINH, RANGE, count_lanes_v2di (special));
+
+  scale = __sinh_exp_reduce (a, &tmp, &sbits);
+  e = __sinh_expm1 (a, scale, tmp);
+  y = 0.5 * (e + e / (e + 1.0));
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    y = select_v2df (special,
+		     exp_specialcase_v2df (tmp, sbits - (1ULL << 52), special),
+		     y);
+  return __sinh_copysign (y, x);
+}
+
+//
+// hyperbolic cosine entry point
+//
+
+/* cosh(a) = (s + 1/s)/2 with s = exp(a), again a sum of nonnegative
+   terms, and exp(a)/2 where exp(a) may overflow.  */
+static __always_inline __Float64x2_t
+__cosh_v2df(__Float64x2_t x)
+{
+  __Float64x2_t a, scale, tmp, s, y;
+  __Uint64x2_t sbits, special;
+
+  MVEC_STATS_VECTOR (COSH);
+
+  a = __builtin_aarch64_absv2df (x);
+  a = __builtin_aarch64_smin_nanv2df (a, (__Float64x2_t) { BOUND, BOUND });
+  special = (__Uint64x2_t) (a > SPECIAL_BOUND);
+  MVEC_STATS_LANES (COSH, RANGE, count_lanes_v2di (special));
+
+  scale = __sinh_exp_reduce (a, &tmp, &sbits);
+  s = scale + scale * tmp;
+  y = 0.5 * s + 0.5 / s;
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    y = select_v2df (special,
+		     exp_specialcase_v2df (tmp, sbits - (1ULL << 52), special),
+		     y);
+  return y;
+}
+
+//
+// hyperbolic tangent entry point
+//
+
+/* tanh(a) = e/(e + 2) with e = expm1(2a).  Clamping a to TANH_BOUND
+   saturates the result to 1.  */
+static __always_inline __Float64x2_t
+__tanh_v2df(__Float64x2_t x)
+{
+  __Float64x2_t a, scale, tmp, e, y;
+  __Uint64x2_t sbits;
+
+  MVEC_STATS_VECTOR (TANH);
+
+  a = __builtin_aarch64_absv2df (x);
+  a = __builtin_aarch64_smin_nanv2df (a, (__Float64x2_t) { TANH_BOUND,
+							   TANH_BOUND });
+  a = a + a;
+
+  scale = __sinh_exp_reduce (a, &tmp, &sbits);
+  e = __sinh_expm1 (a, scale, tmp);
+  y = e / (e + 2.0);
+  return __sinh_copysign (y, x);
+}
+
+#undef N
+#undef InvLn2N
+#undef NegLn2hiN
+#undef NegLn2loN
+#undef Shift
+#undef T
+#undef C2
+#undef C3
+#undef C4
+#undef C5
+#undef BOUND
+#undef SPECIAL_BOUND
+#undef TANH_BOUND
+#undef SMALL
+
+#endif
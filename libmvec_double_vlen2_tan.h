@@ -0,0 +1,56 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _LIBMVEC_DOUBLE_VLEN2_TAN_H
+#define _LIBMVEC_DOUBLE_VLEN2_TAN_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "endian.h"
+#include "libmvec_double_sinetable.h"
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+#include "libmvec_double_sinekernel.h"
+
+//
+// tangent entry point
+//
+
+static __always_inline
+__Float64x2_t __tan_v2df(__Float64x2_t x)
+{
+__Float64x2_t result, c, xs;
+__Uint64x2_t special;
+
+  MVEC_STATS_VECTOR (TAN);
+
+  c = __builtin_aarch64_absv2df (x);
+
+  /* inf and nan lanes are fed to the kernel as zero and give nan.  */
+  special = (__Uint64x2_t) ~(c < INFINITY);
+  MVEC_STATS_LANES (TAN, SPECIAL, count_lanes_v2di (special));
+  MVEC_STATS_LANES (TAN, RANGE,
+		    count_lanes_v2di ((__Uint64x2_t) (c > CUTOFF) & ~special));
+  xs = select_v2df (special, (__Float64x2_t) { 0.0, 0.0 }, x);
+
+  result = _tan_kernel (xs);
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    result = select_v2df (special, x - x, result);
+  return (result);
+}
+
+#endif
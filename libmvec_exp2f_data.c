@@ -1,2 +1,33 @@
 #include <math_config.h>
 #include <e_exp2f_data.c>
+#include "libmvec_util.h"
+#include "libmvec_float_data.h"
+
+#define D __exp2f_data
+
+const struct exp2f_v2df_data __exp2f_v2df_data = {
+  .shift_scaled = V2 (D.shift_scaled),
+  .poly = { V2 (D.poly[0]), V2 (D.poly[1]), V2 (D.poly[2]) },
+  .shift = V2 (D.shift),
+  .invln2_scaled = V2 (D.invln2_scaled),
+  .poly_scaled = { V2 (D.poly_scaled[0]), V2 (D.poly_scaled[1]),
+		   V2 (D.poly_scaled[2]) },
+};
+
+/* The words of D.tab, which is 2^(i/N) with i << (52 - EXP2F_TABLE_BITS)
+   subtracted from the bits.  They are read from D.tab so that the two
+   tables cannot disagree.  */
+#define HI(i) (uint32_t) (D.tab[i] >> 32)
+#define LO(i) (uint32_t) D.tab[i]
+#define ROW(W, i) W (i), W (i + 1), W (i + 2), W (i + 3)
+
+const struct exp2f_tbl_data __exp2f_tbl_data = {
+  .hi = {
+    ROW (HI, 0), ROW (HI, 4), ROW (HI, 8), ROW (HI, 12),
+    ROW (HI, 16), ROW (HI, 20), ROW (HI, 24), ROW (HI, 28),
+  },
+  .lo = {
+    ROW (LO, 0), ROW (LO, 4), ROW (LO, 8), ROW (LO, 12),
+    ROW (LO, 16), ROW (LO, 20), ROW (LO, 24), ROW (LO, 28),
+  },
+};
@@ -1 +1,18 @@
 #include <e_exp_data.c>
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+
+#define D __exp_data
+
+const struct exp_v2df_data __exp_v2df_data = {
+  .invln2N = V2 (D.invln2N),
+  .shift = V2 (D.shift),
+  .negln2hiN = V2 (D.negln2hiN),
+  .negln2loN = V2 (D.negln2loN),
+  .poly = { V2 (D.poly[0]), V2 (D.poly[1]), V2 (D.poly[2]),
+	    V2 (D.poly[3]) },
+  .exp2_shift = V2 (D.exp2_shift),
+  .exp2_poly = { V2 (D.exp2_poly[0]), V2 (D.exp2_poly[1]),
+		 V2 (D.exp2_poly[2]), V2 (D.exp2_poly[3]),
+		 V2 (D.exp2_poly[4]) },
+};
@@ -0,0 +1,121 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _LIBMVEC_FLOAT_DATA_H
+#define _LIBMVEC_FLOAT_DATA_H
+
+#include "math_config.h"
+#include "libmvec_util.h"
+
+//
+// The scalar constants of the glibc single precision tables, each
+// replicated across a vector, like those in libmvec_double_data.h.
+// The float kernels evaluate in double, so the vectors are two doubles.
+//
+
+extern const struct exp2f_v2df_data
+{
+  __Float64x2_t shift_scaled;
+  __Float64x2_t poly[EXP2F_POLY_ORDER];
+  __Float64x2_t shift;
+  __Float64x2_t invln2_scaled;
+  __Float64x2_t poly_scaled[EXP2F_POLY_ORDER];
+} __exp2f_v2df_data attribute_hidden;
+
+/* __exp2f_data.tab split into the high and low words of its entries.
+   Each half is 128 bytes, which one TBL and one TBX of four registers
+   cover, so the kernels look the scale up without leaving the vector
+   registers.  */
+extern const struct exp2f_tbl_data
+{
+  uint32_t hi[1 << EXP2F_TABLE_BITS];
+  uint32_t lo[1 << EXP2F_TABLE_BITS];
+} __exp2f_tbl_data attribute_hidden;
+
+/* 2^(k/N) for the k in the low bits of the four lanes of KI_0 and KI_1,
+   left in *S_0 and *S_1, the shared scale computation of the float exp
+   kernels.  The lanes are narrowed to 32 bits so that one lookup per
+   table word covers all four.  */
+static __always_inline void
+exp2f_scale_v2df (__Uint64x2_t ki_0, __Uint64x2_t ki_1,
+		  __Float64x2_t *s_0, __Float64x2_t *s_1)
+{
+  __Uint32x4_t i, hi, lo;
+  __Uint64x2_t t_0, t_1;
+
+  _Static_assert (EXP2F_TABLE_BITS == 5, "lookup32_v4si needs 32 entries");
+  i = __builtin_shuffle ((__Uint32x4_t) ki_0, (__Uint32x4_t) ki_1,
+			 (__Uint32x4_t) { 0, 2, 4, 6 });
+  i &= (1 << EXP2F_TABLE_BITS) - 1;
+  hi = lookup32_v4si (__exp2f_tbl_data.hi, i);
+  lo = lookup32_v4si (__exp2f_tbl_data.lo, i);
+  t_0 = (__Uint64x2_t) __builtin_shuffle (lo, hi,
+					  (__Uint32x4_t) { 0, 4, 1, 5 });
+  t_1 = (__Uint64x2_t) __builtin_shuffle (lo, hi,
+					  (__Uint32x4_t) { 2, 6, 3, 7 });
+  *s_0 = (__Float64x2_t) (t_0 + (ki_0 << (52 - EXP2F_TABLE_BITS)));
+  *s_1 = (__Float64x2_t) (t_1 + (ki_1 << (52 - EXP2F_TABLE_BITS)));
+}
+
+extern const struct logf_v2df_data
+{
+  __Float64x2_t ln2;
+  __Float64x2_t poly[LOGF_POLY_ORDER - 1];
+} __logf_v2df_data attribute_hidden;
+
+extern const struct log2f_v2df_data
+{
+  __Float64x2_t poly[LOG2F_POLY_ORDER];
+} __log2f_v2df_data attribute_hidden;
+
+/* The invc and logc columns of __logf_data.tab, __log2f_data.tab and
+   __powf_log2_data.tab as separate arrays, which logf_lookup_v2df reads
+   with TBL.  */
+extern const struct logf_tbl_data
+{
+  double invc[1 << LOGF_TABLE_BITS];
+  double logc[1 << LOGF_TABLE_BITS];
+} __logf_tbl_data attribute_hidden, __log2f_tbl_data attribute_hidden,
+  __powf_log2_tbl_data attribute_hidden;
+
+/* invc and logc of the entries of TBL at the indices in I, those of the
+   first two lanes in *INVC_0 and *LOGC_0 and of the last two in *INVC_1
+   and *LOGC_1.  */
+static __always_inline void
+logf_lookup_v2df (const struct logf_tbl_data *tbl, __Uint32x4_t i,
+		  __Float64x2_t *invc_0, __Float64x2_t *invc_1,
+		  __Float64x2_t *logc_0, __Float64x2_t *logc_1)
+{
+  _Static_assert (LOGF_TABLE_BITS == 4 && LOG2F_TABLE_BITS == 4
+		  && POWF_LOG2_TABLE_BITS == 4,
+		  "lookup16_v2df needs 16 entries");
+  lookup16_v2df (tbl->invc, i, invc_0, invc_1);
+  lookup16_v2df (tbl->logc, i, logc_0, logc_1);
+}
+
+extern const struct powf_log2_v2df_data
+{
+  __Float64x2_t poly[POWF_LOG2_POLY_ORDER];
+} __powf_log2_v2df_data attribute_hidden;
+
+//
+// Coefficients of single kernels, defined in libmvec_poly_data.c.
+//
+
+extern const __Float64x2_t __asinf_poly[7] attribute_hidden;
+extern const __Float64x2_t __atanf_poly[6] attribute_hidden;
+
+#endif
@@ -0,0 +1,74 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* Based on expf.c from https://github.com/ARM-software/optimized-routines */
+
+#include <math.h>
+#include <stdint.h>
+#include <sysdeps/ieee754/flt-32/math_config.h>
+#include "libmvec_sve_util.h"
+
+#define N (1 << EXP2F_TABLE_BITS)
+/* Same limit as in _ZGVnN4v_expf.  */
+#define LIMIT 150.0f
+
+#define InvLn2N __exp2f_data.invln2_scaled
+#define T __exp2f_data.tab
+#define C __exp2f_data.poly_scaled
+#define SHIFT __exp2f_data.shift
+
+/* expf of the float lanes widened to XD.  */
+static __always_inline svfloat64_t
+__sve_expf_half(svbool_t pg, svfloat64_t xd)
+{
+  svfloat64_t z, kd, r, r2, s, y;
+  svuint64_t ki, t;
+
+  /* x*N/Ln2 = k + r with r in [-1/2, 1/2] and int k.  */
+  z = svmul_n_f64_x (pg, xd, InvLn2N);
+  kd = svadd_n_f64_x (pg, z, SHIFT);
+  ki = svreinterpret_u64_f64 (kd);
+  kd = svsub_n_f64_x (pg, kd, SHIFT);
+  r = svsub_f64_x (pg, z, kd);
+
+  /* exp(x) = 2^(k/N) * 2^(r/N) ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
+  t = svld1_gather_u64index_u64 (pg, T, svand_n_u64_x (pg, ki, N - 1));
+  t = svadd_u64_x (pg, t, svlsl_n_u64_x (pg, ki, 52 - EXP2F_TABLE_BITS));
+  s = svreinterpret_f64_u64 (t);
+  r2 = svmul_f64_x (pg, r, r);
+  y = svmla_n_f64_x (pg, svdup_n_f64 (C[1]), r, C[0]);
+  y = svmla_f64_x (pg, svmla_n_f64_x (pg, svdup_n_f64 (1.0), r, C[2]),
+		   y, r2);
+  return svmul_f64_x (pg, y, s);
+}
+
+svfloat32_t
+_ZGVsMxv_expf(svfloat32_t x, svbool_t pg)
+{
+  svbool_t pgo;
+
+  MVEC_STATS_VECTOR (EXPF);
+
+  /* FMIN and FMAX propagate nan.  */
+  x = svmin_n_f32_x (pg, x, LIMIT);
+  x = svmax_n_f32_x (pg, x, -LIMIT);
+
+  pgo = sve_odd_pg (pg);
+  return sve_pack_f32 (pg, pgo, __sve_expf_half (pg, sve_even_f64 (pg, x)),
+		       __sve_expf_half (pgo, sve_odd_f64 (pgo, x)));
+}
+weak_alias (_ZGVsMxv_expf, _ZGVsMxv___expf_finite)
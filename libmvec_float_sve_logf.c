@@ -0,0 +1,116 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* Based on logf.c from https://github.com/ARM-software/optimized-routines */
+
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+#include <sysdeps/ieee754/flt-32/math_config.h>
+#include "libmvec_sve_util.h"
+
+#define T __logf_data.tab
+#define A __logf_data.poly
+#define Ln2 __logf_data.ln2
+#define N (1 << LOGF_TABLE_BITS)
+#define OFF 0x3f330000
+/* Distance between two table entries in doubles.  */
+#define STRIDE (sizeof (T[0]) / sizeof (double))
+
+/* log(x) = log1p(z/c-1) + log(c) + k*Ln2 for the lanes split into
+   the widened Z, K and the table index I.  */
+static __always_inline svfloat64_t
+__sve_logf_half(svbool_t pg, svfloat64_t z, svfloat64_t k, svuint64_t i)
+{
+  svfloat64_t invc, logc, r, r2, y0, y;
+
+  i = svmul_n_u64_x (pg, i, STRIDE);
+  invc = svld1_gather_u64index_f64 (pg, &T[0].invc, i);
+  logc = svld1_gather_u64index_f64 (pg, &T[0].logc, i);
+  r = svmad_n_f64_x (pg, z, invc, -1.0);
+  y0 = svmla_n_f64_x (pg, logc, k, Ln2);
+  /* Pipelined polynomial evaluation to approximate log1p(r).  */
+  r2 = svmul_f64_x (pg, r, r);
+  y = svmla_n_f64_x (pg, svdup_n_f64 (A[2]), r, A[1]);
+  y = svmla_n_f64_x (pg, y, r2, A[0]);
+  return svmla_f64_x (pg, svadd_f64_x (pg, y0, r), y, r2);
+}
+
+/* Results for the lanes that are not positive normal numbers, as
+   __logf_special in libmvec_float_vlen4_logf.h.  */
+static __always_inline svfloat32_t
+__sve_logf_special(svbool_t pg, svfloat32_t x, svfloat32_t y)
+{
+  svfloat32_t e;
+  svbool_t fix;
+
+  fix = svnot_b_z (pg, svand_b_z (pg, svcmpgt_n_f32 (pg, x, 0.0f),
+				  svcmple_n_f32 (pg, x, FLT_MAX)));
+  e = svsel_f32 (svcmpeq_n_f32 (pg, x, 0.0f), svdup_n_f32 (-INFINITY),
+		 svadd_f32_x (pg, x, x));
+  e = svsel_f32 (svcmplt_n_f32 (pg, x, 0.0f), svdup_n_f32 (NAN), e);
+  return svsel_f32 (fix, e, y);
+}
+
+svfloat32_t
+_ZGVsMxv_logf(svfloat32_t x, svbool_t pg)
+{
+  svfloat32_t z, result;
+  svuint32_t ix, tmp, i;
+  svint32_t k;
+  svbool_t pgo, special, sub;
+
+  MVEC_STATS_VECTOR (LOGF);
+
+  /* Zero, negative, subnormal, inf and nan lanes.  Subnormal inputs
+     are normalized in the vector, the rest get their result from
+     __sve_logf_special at the end.  */
+  special = svnot_b_z (pg, svand_b_z (pg, svcmpge_n_f32 (pg, x, FLT_MIN),
+				      svcmple_n_f32 (pg, x, FLT_MAX)));
+  MVEC_STATS_LANES (LOGF, SPECIAL, sve_count_lanes_f32 (pg, special));
+  ix = svreinterpret_u32_f32 (x);
+  if (__glibc_unlikely (svptest_any (pg, special)))
+    {
+      sub = svand_b_z (pg, svcmpgt_n_f32 (pg, x, 0.0f),
+		       svcmplt_n_f32 (pg, x, FLT_MIN));
+      ix = svsub_n_u32_m (sub,
+			  svreinterpret_u32_f32 (svmul_n_f32_m (sub, x, 0x1p23f)),
+			  23 << 23);
+    }
+
+  tmp = svsub_n_u32_x (pg, ix, OFF);
+  i = svand_n_u32_x (pg, svlsr_n_u32_x (pg, tmp, 23 - LOGF_TABLE_BITS), N - 1);
+  k = svasr_n_s32_x (pg, svreinterpret_s32_u32 (tmp), 23);
+  z = svreinterpret_f32_u32 (svsub_u32_x (pg, ix,
+					  svand_n_u32_x (pg, tmp, 0x1ff << 23)));
+
+  pgo = sve_odd_pg (pg);
+  result = sve_pack_f32 (pg, pgo,
+			 __sve_logf_half (pg, sve_even_f64 (pg, z),
+					  sve_even_f64_s32 (pg, k),
+					  sve_even_u64 (pg, i)),
+			 __sve_logf_half (pgo, sve_odd_f64 (pgo, z),
+					  sve_odd_f64_s32 (pgo, k),
+					  sve_odd_u64 (pgo, i)));
+
+  /* logf(1) is exactly +0 in every rounding mode.  */
+  result = svsel_f32 (svcmpeq_n_f32 (pg, x, 1.0f), svdup_n_f32 (0.0f), result);
+  if (__glibc_unlikely (svptest_any (pg, special)))
+    return __sve_logf_special (pg, x, result);
+  return result;
+}
+weak_alias (_ZGVsMxv_logf, _ZGVsMxv___logf_finite)
@@ -0,0 +1,183 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* Based on powf.c from https://github.com/ARM-software/optimized-routines */
+
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+#include <sysdeps/ieee754/flt-32/math_config.h>
+#include "libmvec_sve_util.h"
+
+#define N (1 << POWF_LOG2_TABLE_BITS)
+#define T __powf_log2_data.tab
+#define A __powf_log2_data.poly
+#define OFF 0x3f330000
+/* Distance between two table entries in doubles.  */
+#define STRIDE (sizeof (T[0]) / sizeof (double))
+
+#define N_EXP (1 << EXP2F_TABLE_BITS)
+#define T_EXP __exp2f_data.tab
+#define C __exp2f_data.poly
+#define SHIFT __exp2f_data.shift_scaled
+
+/* Same limit as in _ZGVnN4vv_powf.  */
+#define LIMIT 200.0
+
+/* exp2(y*log2(x)) for the lanes split into the widened Z, K, the
+   table index I and the widened Y, as _ZGVnN4vv_powf.  */
+static __always_inline svfloat64_t
+__sve_powf_half(svbool_t pg, svfloat64_t z, svfloat64_t k, svuint64_t i,
+		svfloat64_t y)
+{
+  svfloat64_t invc, logc, r, r2, r4, p, q, xd, kd, s;
+  svuint64_t ki, t;
+
+  /* log2(x) = log1p(z/c-1)/ln2 + log2(c) + k, scaled by POWF_SCALE.  */
+  i = svmul_n_u64_x (pg, i, STRIDE);
+  invc = svld1_gather_u64index_f64 (pg, &T[0].invc, i);
+  logc = svld1_gather_u64index_f64 (pg, &T[0].logc, i);
+  r = svmad_n_f64_x (pg, z, invc, -1.0);
+  q = svadd_f64_x (pg, logc, k);
+  r2 = svmul_f64_x (pg, r, r);
+  r4 = svmul_f64_x (pg, r2, r2);
+  p = svmla_n_f64_x (pg, svdup_n_f64 (A[3]), r, A[2]);
+  q = svmla_n_f64_x (pg, q, r, A[4]);
+  q = svmla_f64_x (pg, q, p, r2);
+  p = svmla_n_f64_x (pg, svdup_n_f64 (A[1]), r, A[0]);
+  q = svmla_f64_x (pg, q, p, r4);
+
+  /* y*log2(x) cannot overflow in double since y is a float.  */
+  xd = svmul_n_f64_x (pg, svmul_f64_x (pg, y, q), 1.0 / POWF_SCALE);
+  xd = svmin_n_f64_x (pg, xd, LIMIT);
+  xd = svmax_n_f64_x (pg, xd, -LIMIT);
+
+  /* xd = k/N + r with r in [-1/(2N), 1/(2N)] and int k.  */
+  kd = svadd_n_f64_x (pg, xd, SHIFT);
+  ki = svreinterpret_u64_f64 (kd);
+  kd = svsub_n_f64_x (pg, kd, SHIFT);
+  r = svsub_f64_x (pg, xd, kd);
+
+  /* exp2(x) = 2^(k/N) * 2^r ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
+  t = svld1_gather_u64index_u64 (pg, T_EXP, svand_n_u64_x (pg, ki, N_EXP - 1));
+  t = svadd_u64_x (pg, t, svlsl_n_u64_x (pg, ki, 52 - EXP2F_TABLE_BITS));
+  s = svreinterpret_f64_u64 (t);
+  r2 = svmul_f64_x (pg, r, r);
+  p = svmla_n_f64_x (pg, svdup_n_f64 (C[1]), r, C[0]);
+  p = svmla_f64_x (pg, svmla_n_f64_x (pg, svdup_n_f64 (1.0), r, C[2]),
+		   p, r2);
+  return svmul_f64_x (pg, p, s);
+}
+
+/* Results for the lanes where x is zero, inf or nan or y is inf or
+   nan, following the special cases of the scalar powf.  ODD marks
+   the lanes with an odd integer y.  */
+static __always_inline svfloat32_t
+__sve_powf_special(svbool_t pg, svfloat32_t x, svfloat32_t y, svbool_t odd)
+{
+  svfloat32_t x2, e, ax;
+  svbool_t zero;
+
+  /* x is +-0 or +-inf.  */
+  x2 = svmul_f32_x (pg, x, x);
+  x2 = svneg_f32_m (x2, svand_b_z (pg, odd, svcmplt_n_f32 (pg, x, 0.0f)), x2);
+  e = svsel_f32 (svcmplt_n_f32 (pg, y, 0.0f), svdivr_n_f32_x (pg, x2, 1.0f),
+		 x2);
+
+  /* y is +-inf: 1 for |x| == 1, 0 when |x| > 1 and y < 0 or
+     |x| < 1 and y > 0, inf otherwise.  */
+  ax = svabs_f32_x (pg, x);
+  zero = sveor_b_z (pg, svcmplt_n_f32 (pg, ax, 1.0f),
+		    svcmplt_n_f32 (pg, y, 0.0f));
+  e = svsel_f32 (svcmpeq_n_f32 (pg, svabs_f32_x (pg, y), INFINITY),
+		 svsel_f32 (svcmpeq_n_f32 (pg, ax, 1.0f), svdup_n_f32 (1.0f),
+			    svsel_f32 (zero, svdup_n_f32 (0.0f),
+				       svdup_n_f32 (INFINITY))),
+		 e);
+
+  /* nan in either argument, except powf(1, y) and powf(x, 0).  */
+  e = svsel_f32 (svcmpuo_f32 (pg, x, y), svadd_f32_x (pg, x, y), e);
+  e = svsel_f32 (svorr_b_z (pg, svcmpeq_n_f32 (pg, x, 1.0f),
+			    svcmpeq_n_f32 (pg, y, 0.0f)),
+		 svdup_n_f32 (1.0f), e);
+  return e;
+}
+
+svfloat32_t
+_ZGVsMxvv_powf(svfloat32_t x, svfloat32_t y, svbool_t pg)
+{
+  svfloat32_t ax, ys, yh, z, result;
+  svuint32_t ix, tmp, i;
+  svint32_t k;
+  svbool_t pgo, special, neg, yint, odd, invalid, sub;
+
+  MVEC_STATS_VECTOR (POWF);
+
+  /* Lanes where x is zero, inf or nan or y is inf or nan get their
+     result from __sve_powf_special, they are replaced by 1^1 in the
+     main evaluation.  */
+  ax = svabs_f32_x (pg, x);
+  special = svnot_b_z (pg, svand_b_z (pg, svand_b_z (pg, svcmpgt_n_f32 (pg, ax, 0.0f),
+						       svcmple_n_f32 (pg, ax, FLT_MAX)),
+				      svacle_n_f32 (pg, y, FLT_MAX)));
+  MVEC_STATS_LANES (POWF, SPECIAL, sve_count_lanes_f32 (pg, special));
+  ax = svsel_f32 (special, svdup_n_f32 (1.0f), ax);
+  ys = svsel_f32 (special, svdup_n_f32 (1.0f), y);
+
+  /* powf(x, y) = +-powf(|x|, y) for x < 0 and integer y, with the
+     sign of x when y is odd, and nan when y is not an integer.  */
+  neg = svcmplt_n_f32 (pg, x, 0.0f);
+  yint = svcmpeq_f32 (pg, svrintz_f32_x (pg, y), y);
+  yh = svmul_n_f32_x (pg, y, 0.5f);
+  odd = svand_b_z (pg, yint, svcmpne_f32 (pg, svrintz_f32_x (pg, yh), yh));
+  invalid = svbic_b_z (pg, neg, yint);
+
+  /* Normalize subnormal x.  */
+  ix = svreinterpret_u32_f32 (ax);
+  sub = svcmplt_n_f32 (pg, ax, FLT_MIN);
+  if (__glibc_unlikely (svptest_any (pg, sub)))
+    ix = svsub_n_u32_m (sub,
+			svreinterpret_u32_f32 (svmul_n_f32_m (sub, ax, 0x1p23f)),
+			23 << 23);
+
+  tmp = svsub_n_u32_x (pg, ix, OFF);
+  i = svand_n_u32_x (pg, svlsr_n_u32_x (pg, tmp, 23 - POWF_LOG2_TABLE_BITS),
+		     N - 1);
+  k = svasr_n_s32_x (pg, svreinterpret_s32_u32 (svand_n_u32_x (pg, tmp,
+							       0xff800000)),
+		     23 - POWF_SCALE_BITS);
+  z = svreinterpret_f32_u32 (svsub_u32_x (pg, ix,
+					  svand_n_u32_x (pg, tmp, 0xff800000)));
+
+  pgo = sve_odd_pg (pg);
+  result = sve_pack_f32 (pg, pgo,
+			 __sve_powf_half (pg, sve_even_f64 (pg, z),
+					  sve_even_f64_s32 (pg, k),
+					  sve_even_u64 (pg, i),
+					  sve_even_f64 (pg, ys)),
+			 __sve_powf_half (pgo, sve_odd_f64 (pgo, z),
+					  sve_odd_f64_s32 (pgo, k),
+					  sve_odd_u64 (pgo, i),
+					  sve_odd_f64 (pgo, ys)));
+  result = svneg_f32_m (result, svand_b_z (pg, neg, odd), result);
+
+  result = svsel_f32 (invalid, svdup_n_f32 (NAN), result);
+  if (__glibc_unlikely (svptest_any (pg, special)))
+    result = svsel_f32 (special, __sve_powf_special (pg, x, y, odd), result);
+  return result;
+}
+weak_alias (_ZGVsMxvv_powf, _ZGVsMxvv___powf_finite)
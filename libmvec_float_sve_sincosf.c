@@ -0,0 +1,160 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <stdint.h>
+#include <math.h>
+#include "libmvec_sve_util.h"
+
+/* Same reduction and polynomial as in _ZGVnN4v_sinf.  Lanes with
+   |x| >= RANGE, inf and nan go through the double kernels.  */
+#define RANGE 0x1p20f
+#define SHIFT 0x1.8p23f
+
+#define InvPi 0x1.45f306p-2f
+#define Pi1 0x1.921fb6p+1f
+#define Pi2 -0x1.777a5cp-24f
+#define Pi3 -0x1.ee59dap-49f
+
+/* sin(r) ~= r + r^3 * P(r^2) for |r| <= pi/2.  */
+#define P0 -0x1.555548p-3f
+#define P1 0x1.110df4p-7f
+#define P2 -0x1.9f42eap-13f
+#define P3 0x1.5b2e76p-19f
+
+extern svfloat64_t _ZGVsMxv_sin (svfloat64_t, svbool_t);
+extern svfloat64_t _ZGVsMxv_cos (svfloat64_t, svbool_t);
+
+/* r = |x| - n*pi with the three part pi.  */
+static __always_inline svfloat32_t
+__sve_sinf_reduce(svbool_t pg, svfloat32_t a, svfloat32_t n)
+{
+  svfloat32_t r;
+
+  r = svmls_n_f32_x (pg, a, n, Pi1);
+  r = svmls_n_f32_x (pg, r, n, Pi2);
+  return svmls_n_f32_x (pg, r, n, Pi3);
+}
+
+/* sin(r) for |r| <= pi/2.  */
+static __always_inline svfloat32_t
+__sve_sinf_poly(svbool_t pg, svfloat32_t r)
+{
+  svfloat32_t r2, y;
+
+  r2 = svmul_f32_x (pg, r, r);
+  y = svmla_n_f32_x (pg, svdup_n_f32 (P2), r2, P3);
+  y = svmad_n_f32_x (pg, y, r2, P1);
+  y = svmad_n_f32_x (pg, y, r2, P0);
+  return svmla_f32_x (pg, r, svmul_f32_x (pg, y, r2), r);
+}
+
+//
+// sine entry point
+//
+
+/* sin(x) = sign(x) (-1)^n sin(r) with r = |x| - n*pi in [-pi/2, pi/2],
+   as in _ZGVnN4v_sinf.  */
+svfloat32_t
+_ZGVsMxv_sinf(svfloat32_t x, svbool_t pg)
+{
+  svfloat32_t a, n, y;
+  svuint32_t odd, sign;
+  svbool_t large, largeo;
+
+  MVEC_STATS_VECTOR (SINF);
+
+  a = svabs_f32_x (pg, x);
+  sign = svand_n_u32_x (pg, svreinterpret_u32_f32 (x), 0x80000000);
+  large = svnot_b_z (pg, svaclt_n_f32 (pg, x, RANGE));
+  MVEC_STATS_LANES (SINF, SPECIAL,
+		    sve_count_lanes_f32 (pg, large)
+		    - sve_count_lanes_f32 (large,
+					   svaclt_n_f32 (large, x, INFINITY)));
+  MVEC_STATS_LANES (SINF, RANGE,
+		    sve_count_lanes_f32 (large,
+					 svaclt_n_f32 (large, x, INFINITY)));
+
+  n = svmla_n_f32_x (pg, svdup_n_f32 (SHIFT), a, InvPi);
+  odd = svlsl_n_u32_x (pg, svreinterpret_u32_f32 (n), 31);
+  n = svsub_n_f32_x (pg, n, SHIFT);
+
+  y = __sve_sinf_poly (pg, __sve_sinf_reduce (pg, a, n));
+  y = svreinterpret_f32_u32 (sveor_u32_x (pg, svreinterpret_u32_f32 (y),
+					  sveor_u32_x (pg, odd, sign)));
+  if (__glibc_unlikely (svptest_any (pg, large)))
+    {
+      largeo = sve_odd_pg (large);
+      y = svsel_f32 (large,
+		     sve_pack_f32 (large, largeo,
+				   _ZGVsMxv_sin (sve_even_f64 (large, x),
+						 large),
+				   _ZGVsMxv_sin (sve_odd_f64 (largeo, x),
+						 largeo)),
+		     y);
+    }
+  return y;
+}
+weak_alias (_ZGVsMxv_sinf, _ZGVsMxv___sinf_finite)
+
+//
+// cosine entry point
+//
+
+/* cos(x) = (-1)^n sin(r) with n = rint(|x|/pi + 1/2) and
+   r = |x| - (n - 1/2)*pi in [-pi/2, pi/2], as in _ZGVnN4v_cosf.  */
+svfloat32_t
+_ZGVsMxv_cosf(svfloat32_t x, svbool_t pg)
+{
+  svfloat32_t a, n, y;
+  svuint32_t odd;
+  svbool_t large, largeo;
+
+  MVEC_STATS_VECTOR (COSF);
+
+  a = svabs_f32_x (pg, x);
+  large = svnot_b_z (pg, svaclt_n_f32 (pg, x, RANGE));
+  MVEC_STATS_LANES (COSF, SPECIAL,
+		    sve_count_lanes_f32 (pg, large)
+		    - sve_count_lanes_f32 (large,
+					   svaclt_n_f32 (large, x, INFINITY)));
+  MVEC_STATS_LANES (COSF, RANGE,
+		    sve_count_lanes_f32 (large,
+					 svaclt_n_f32 (large, x, INFINITY)));
+
+  /* SHIFT + 0.5 is not a float, add the two separately.  */
+  n = svmla_n_f32_x (pg, svdup_n_f32 (0.5f), a, InvPi);
+  n = svadd_n_f32_x (pg, n, SHIFT);
+  odd = svlsl_n_u32_x (pg, svreinterpret_u32_f32 (n), 31);
+  n = svsub_n_f32_x (pg, svsub_n_f32_x (pg, n, SHIFT), 0.5f);
+
+  y = __sve_sinf_poly (pg, __sve_sinf_reduce (pg, a, n));
+  y = svreinterpret_f32_u32 (sveor_u32_x (pg, svreinterpret_u32_f32 (y),
+					  odd));
+  if (__glibc_unlikely (svptest_any (pg, large)))
+    {
+      largeo = sve_odd_pg (large);
+      y = svsel_f32 (large,
+		     sve_pack_f32 (large, largeo,
+				   _ZGVsMxv_cos (sve_even_f64 (large, x),
+						 large),
+				   _ZGVsMxv_cos (sve_odd_f64 (largeo, x),
+						 largeo)),
+		     y);
+    }
+  return y;
+}
+weak_alias (_ZGVsMxv_cosf, _ZGVsMxv___cosf_finite)
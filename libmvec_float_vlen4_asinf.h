@@ -0,0 +1,126 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _LIBMVEC_FLOAT_VLEN4_ASINF_H
+#define _LIBMVEC_FLOAT_VLEN4_ASINF_H
+
+#include <stdint.h>
+#include <math.h>
+#include "endian.h"
+#include "libmvec_util.h"
+#include "libmvec_float_data.h"
+
+/* asin(sqrt(z))/sqrt(z) = 1 + z * P(z) on [0, 1/4], computed in
+   double.  The approximation error of asin is below 2^-33
+   relative.  */
+#define P __asinf_poly
+#define Pio2 0x1.921fb54442d18p+0
+#define Pi 0x1.921fb54442d18p+1
+
+/* Shared reduction of asinf and acosf for A = |x| widened to double:
+   S = A for A < 1/2 (SMALL), otherwise S = sqrt((1 - A)/2), and the
+   return value is asin(S).  A > 1 gives nan through the square
+   root.  */
+static __always_inline __Float64x2_t
+__asinf_reduce(__Float64x2_t a, __Uint64x2_t small)
+{
+  __Float64x2_t z, s, z2, y;
+  __Float64x2_t P0_v, P1_v, P2_v, P3_v, P4_v, P5_v, P6_v;
+
+  z = select_v2df (small, a * a, (1.0 - a) * 0.5);
+  s = select_v2df (small, a, __builtin_aarch64_sqrtv2df (z));
+
+  P0_v = P[0];
+  P1_v = P[1];
+  P2_v = P[2];
+  P3_v = P[3];
+  P4_v = P[4];
+  P5_v = P[5];
+  P6_v = P[6];
+
+  z2 = z * z;
+  y = (P0_v + z * P1_v) + z2 * (P2_v + z * P3_v)
+      + z2 * z2 * ((P4_v + z * P5_v) + z2 * P6_v);
+  return s + s * z * y;
+}
+
+//
+// arcsine entry point
+//
+
+static __always_inline __Float64x2_t
+__asinf_half(__Float64x2_t x)
+{
+  __Float64x2_t a, p, r;
+  __Uint64x2_t small, sign;
+
+  a = __builtin_aarch64_absv2df (x);
+  small = (__Uint64x2_t) (a < 0.5);
+  p = __asinf_reduce (a, small);
+  r = select_v2df (small, p, Pio2 - 2.0 * p);
+  sign = (__Uint64x2_t) x & 0x8000000000000000;
+  return (__Float64x2_t) ((__Uint64x2_t) r | sign);
+}
+
+static __always_inline __Float32x4_t
+__asinf_v4sf(__Float32x4_t x)
+{
+  __Float64x2_t y_0, y_1;
+
+  MVEC_STATS_VECTOR (ASINF);
+
+  y_0 = __asinf_half (get_lo_and_extend (x));
+  y_1 = __asinf_half (get_hi_and_extend (x));
+  return pack_and_trunc (y_0, y_1);
+}
+
+//
+// arccosine entry point
+//
+
+static __always_inline __Float64x2_t
+__acosf_half(__Float64x2_t x)
+{
+  __Float64x2_t a, p, r;
+  __Uint64x2_t small;
+
+  a = __builtin_aarch64_absv2df (x);
+  small = (__Uint64x2_t) (a < 0.5);
+  p = __asinf_reduce (a, small);
+  /* The reduction works on |x|, asin(x) has the sign of x.  */
+  r = select_v2df ((__Uint64x2_t) (x > 0.0), 2.0 * p, Pi - 2.0 * p);
+  return select_v2df (small,
+		      Pio2 - select_v2df ((__Uint64x2_t) (x < 0.0), -p, p),
+		      r);
+}
+
+static __always_inline __Float32x4_t
+__acosf_v4sf(__Float32x4_t x)
+{
+  __Float64x2_t y_0, y_1;
+
+  MVEC_STATS_VECTOR (ACOSF);
+
+  y_0 = __acosf_half (get_lo_and_extend (x));
+  y_1 = __acosf_half (get_hi_and_extend (x));
+  return pack_and_trunc (y_0, y_1);
+}
+
+#undef P
+#undef Pio2
+#undef Pi
+
+#endif
@@ -0,0 +1,43 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libmvec_float_vlen4_atanf.h"
+
+LIBMVEC_ENTRY (__Float32x4_t, _ZGVnN4v_atanf, (__Float32x4_t x), (x),
+	       __atanf_v4sf)
+weak_alias (_ZGVnN4v_atanf, _ZGVnN4v___atanf_finite)
+
+__AARCH64_VECTOR_PCS_ATTR __Float32x4_t
+_ZGVnM4v_atanf(__Float32x4_t x, __Uint32x4_t mask)
+{
+  return _ZGVnN4v_atanf (mask_v4sf (mask, x, 0.0f));
+}
+weak_alias (_ZGVnM4v_atanf, _ZGVnM4v___atanf_finite)
+
+LIBMVEC_ENTRY (__Float32x4_t, _ZGVnN4vv_atan2f,
+	       (__Float32x4_t y, __Float32x4_t x), (y, x), __atan2f_v4sf)
+weak_alias (_ZGVnN4vv_atan2f, _ZGVnN4vv___atan2f_finite)
+
+__AARCH64_VECTOR_PCS_ATTR __Float32x4_t
+_ZGVnM4vv_atan2f(__Float32x4_t y, __Float32x4_t x, __Uint32x4_t mask)
+{
+  return _ZGVnN4vv_atan2f (mask_v4sf (mask, y, 1.0f),
+			   mask_v4sf (mask, x, 1.0f));
+}
+weak_alias (_ZGVnM4vv_atan2f, _ZGVnM4vv___atan2f_finite)
+
+LIBMVEC_ARRAY_V4SF (mvec_atanf, __atanf_v4sf)
+LIBMVEC_ARRAY2_V4SF (mvec_atan2f, __atan2f_v4sf)
@@ -0,0 +1,178 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _LIBMVEC_FLOAT_VLEN4_ATANF_H
+#define _LIBMVEC_FLOAT_VLEN4_ATANF_H
+
+#include <stdint.h>
+#include <math.h>
+#include "endian.h"
+#include "libmvec_util.h"
+#include "libmvec_float_data.h"
+
+/* K + S * B as in libmvec_double_vlen2_atan.h, rounded to double.  */
+static const double __atanf_base[12] = {
+  0x0.0p+0, 0x1.dac670561bb4fp-2, 0x1.921fb54442d18p-1,
+  0x1.921fb54442d18p+0, 0x1.1b6e192ebbe44p+0, 0x1.921fb54442d18p-1,
+  0x1.921fb54442d18p+1, 0x1.56c6e7397f5aep+1, 0x1.2d97c7f3321d2p+1,
+  0x1.921fb54442d18p+0, 0x1.0468a8ace4df6p+1, 0x1.2d97c7f3321d2p+1
+};
+
+/* atan(sqrt(t))/sqrt(t) = 1 + t * P(t) on [0, 0.1915], computed in
+   double.  The approximation error is below 2^-32 relative.  */
+#define P __atanf_poly
+#define T __atanf_base
+
+/* The reduction of __atan_kernel in libmvec_double_vlen2_atan.h, in
+   double on two float lanes widened to double.  */
+static __always_inline __Float64x2_t
+__atanf_kernel(__Float64x2_t mn, __Float64x2_t mx, __Uint64x2_t swap,
+	       __Uint64x2_t neg)
+{
+  __Float64x2_t c, z, t, t2, p, y, base;
+  __Float64x2_t P0_v, P1_v, P2_v, P3_v, P4_v, P5_v;
+  __Uint64x2_t mid, big, i;
+
+  mid = (__Uint64x2_t) (mn >= 0x1.cp-2 * mx);	/* q >= 7/16 */
+  big = (__Uint64x2_t) (mn >= 0x1.6p-1 * mx);	/* q >= 11/16 */
+  c = select_v2df (big, (__Float64x2_t) { 1.0, 1.0 },
+		   select_v2df (mid, (__Float64x2_t) { 0.5, 0.5 },
+				(__Float64x2_t) { 0.0, 0.0 }));
+  z = (mn - c * mx) / (mx + c * mn);
+
+  P0_v = P[0];
+  P1_v = P[1];
+  P2_v = P[2];
+  P3_v = P[3];
+  P4_v = P[4];
+  P5_v = P[5];
+
+  t = z * z;
+  t2 = t * t;
+  y = (P0_v + t * P1_v) + t2 * (P2_v + t * P3_v) + t2 * t2 * (P4_v + t * P5_v);
+  p = z + z * t * y;
+
+  i = (mid & 1) + (big & 1) + 3 * (swap & 1) + 6 * (neg & 1);
+  base = (__Float64x2_t) { T[i[0]], T[i[1]] };
+  p = select_v2df (swap ^ neg, -p, p);
+  return base + p;
+}
+
+/* Set the sign of the nonnegative R to the sign of X.  */
+static __always_inline __Float64x2_t
+__atanf_copysign(__Float64x2_t r, __Float64x2_t x)
+{
+  __Uint64x2_t sign = (__Uint64x2_t) x & 0x8000000000000000;
+
+  return (__Float64x2_t) ((__Uint64x2_t) r | sign);
+}
+
+//
+// arctangent entry point
+//
+
+static __always_inline __Float64x2_t
+__atanf_half(__Float64x2_t x)
+{
+  __Float64x2_t a, one, mn, mx, r;
+  __Uint64x2_t swap, zero, inf;
+
+  a = __builtin_aarch64_absv2df (x);
+  one = (__Float64x2_t) { 1.0, 1.0 };
+  mn = __builtin_aarch64_smin_nanv2df (a, one);
+  mx = __builtin_aarch64_smax_nanv2df (a, one);
+  swap = (__Uint64x2_t) (a > one);
+  zero = (__Uint64x2_t) { 0, 0 };
+
+  /* atan(inf) is reduced as q = 0, which gives pi/2.  */
+  inf = (__Uint64x2_t) (a == INFINITY);
+  MVEC_STATS_LANES (ATANF, SPECIAL, count_lanes_v2di (inf));
+  if (__glibc_unlikely (any_lane_v2di (inf)))
+    {
+      mn = select_v2df (inf, (__Float64x2_t) { 0.0, 0.0 }, mn);
+      mx = select_v2df (inf, one, mx);
+    }
+
+  r = __atanf_kernel (mn, mx, swap, zero);
+  return __atanf_copysign (r, x);
+}
+
+static __always_inline __Float32x4_t
+__atanf_v4sf(__Float32x4_t x)
+{
+  __Float64x2_t y_0, y_1;
+
+  MVEC_STATS_VECTOR (ATANF);
+
+  y_0 = __atanf_half (get_lo_and_extend (x));
+  y_1 = __atanf_half (get_hi_and_extend (x));
+  return pack_and_trunc (y_0, y_1);
+}
+
+//
+// two-argument arctangent entry point
+//
+
+/* Float inputs are far from the double overflow and underflow
+   thresholds, so only zero, infinite and nan lanes need fixing up,
+   as in __atan2_v2df.  */
+static __always_inline __Float64x2_t
+__atan2f_half(__Float64x2_t y, __Float64x2_t x)
+{
+  __Float64x2_t ax, ay, mn, mx, r;
+  __Uint64x2_t swap, neg, special, bothinf;
+
+  ax = __builtin_aarch64_absv2df (x);
+  ay = __builtin_aarch64_absv2df (y);
+  mn = __builtin_aarch64_smin_nanv2df (ax, ay);
+  mx = __builtin_aarch64_smax_nanv2df (ax, ay);
+  swap = (__Uint64x2_t) (ay > ax);
+  neg = (__Uint64x2_t) ((__Int64x2_t) x < 0);
+
+  special = (__Uint64x2_t) ~((mx > 0.0) & (mx < INFINITY));
+  MVEC_STATS_LANES (ATAN2F, SPECIAL, count_lanes_v2di (special));
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    {
+      bothinf = (__Uint64x2_t) (mn == INFINITY);
+      mn = select_v2df (special,
+			select_v2df (bothinf, (__Float64x2_t) { 1.0, 1.0 },
+				     (__Float64x2_t) { 0.0, 0.0 }), mn);
+      mx = select_v2df (special, (__Float64x2_t) { 1.0, 1.0 }, mx);
+    }
+
+  r = __atanf_kernel (mn, mx, swap, neg);
+  r = __atanf_copysign (r, y);
+  if (__glibc_unlikely (any_lane_v2di (special)))
+    r = select_v2df ((__Uint64x2_t) ((x != x) | (y != y)), x + y, r);
+  return r;
+}
+
+static __always_inline __Float32x4_t
+__atan2f_v4sf(__Float32x4_t y, __Float32x4_t x)
+{
+  __Float64x2_t r_0, r_1;
+
+  MVEC_STATS_VECTOR (ATAN2F);
+
+  r_0 = __atan2f_half (get_lo_and_extend (y), get_lo_and_extend (x));
+  r_1 = __atan2f_half (get_hi_and_extend (y), get_hi_and_extend (x));
+  return pack_and_trunc (r_0, r_1);
+}
+
+#undef P
+#undef T
+
+#endif
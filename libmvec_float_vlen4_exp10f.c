@@ -0,0 +1,30 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libmvec_float_vlen4_exp10f.h"
+
+LIBMVEC_ENTRY (__Float32x4_t, _ZGVnN4v_exp10f, (__Float32x4_t x), (x),
+	       __exp10f_v4sf)
+weak_alias (_ZGVnN4v_exp10f, _ZGVnN4v___exp10f_finite)
+
+__AARCH64_VECTOR_PCS_ATTR __Float32x4_t
+_ZGVnM4v_exp10f(__Float32x4_t x, __Uint32x4_t mask)
+{
+  return _ZGVnN4v_exp10f (mask_v4sf (mask, x, 0.0f));
+}
+weak_alias (_ZGVnM4v_exp10f, _ZGVnM4v___exp10f_finite)
+
+LIBMVEC_ARRAY_V4SF (mvec_exp10f, __exp10f_v4sf)
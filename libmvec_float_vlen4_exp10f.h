@@ -0,0 +1,108 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on expf.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_FLOAT_VLEN4_EXP10F_H
+#define _LIBMVEC_FLOAT_VLEN4_EXP10F_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sysdeps/ieee754/flt-32/math_config.h>
+#include "libmvec_util.h"
+#include "libmvec_float_data.h"
+
+#define N (1 << EXP2F_TABLE_BITS)
+/* exp10f(x) overflows for x > 0x1.344134p5 and underflows to zero for
+   x < -0x1.693c6ap5.  Clamping x to [-LIMIT, LIMIT] keeps every result
+   and the scale computed in double stays in range, so the conversion
+   to float produces the inf, subnormal and zero results.  */
+#define LIMIT 65.0
+
+/* N*log2(10), z = x*InvLog10_2N is computed in double so its rounding
+   error is far below the float precision of the result.  */
+#define InvLog10_2N (0x1.a934f0979a371p1 * N)
+#define C __exp2f_v2df_data.poly_scaled
+#define SHIFT __exp2f_v2df_data.shift
+
+static __always_inline __Float32x4_t
+__exp10f_v4sf(__Float32x4_t x)
+{
+  __Float32x4_t limit, result;
+  __Float64x2_t xd_0, xd_1, vInvLog10_2N, z_0, z_1, vkd_0, vkd_1, r_0, r_1;
+  __Float64x2_t vs_0, vs_1, c0, c1, c2, y_0, y_1, r2_0, r2_1, one;
+  __Float64x2_t shift;
+  __Uint64x2_t ki_0, ki_1;
+
+  MVEC_STATS_VECTOR (EXP10F);
+
+  /* The nan propagating min and max leave nan lanes alone.  */
+  limit = (__Float32x4_t) { LIMIT, LIMIT, LIMIT, LIMIT };
+  x = __builtin_aarch64_smin_nanv4sf (x, limit);
+  x = __builtin_aarch64_smax_nanv4sf (x, -limit);
+
+  xd_0 = get_lo_and_extend (x);
+  xd_1 = get_hi_and_extend (x);
+
+  vInvLog10_2N = (__Float64x2_t) { InvLog10_2N, InvLog10_2N };
+  /* x*N*log2(10) = k + r with r in [-1/2, 1/2] and int k.  */
+  z_0 = vInvLog10_2N * xd_0;
+  z_1 = vInvLog10_2N * xd_1;
+
+  /* Round z to int k by adding and subtracting SHIFT, which leaves k in
+     the low bits of ki.  The result is in [-150*N, 128*N], and the
+     rounding is ties-to-even, otherwise the magnitude of r could be
+     bigger which gives larger approximation error.  The table lookup
+     uses the low bits of ki in the vector registers.  */
+  shift = SHIFT;
+  vkd_0 = z_0 + shift;
+  vkd_1 = z_1 + shift;
+  ki_0 = (__Uint64x2_t) vkd_0;
+  ki_1 = (__Uint64x2_t) vkd_1;
+  vkd_0 -= shift;
+  vkd_1 -= shift;
+  r_0 = z_0 - vkd_0;
+  r_1 = z_1 - vkd_1;
+
+  /* exp10(x) = 2^(k/N) * 2^(r/N) ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
+  exp2f_scale_v2df (ki_0, ki_1, &vs_0, &vs_1);
+  c0 = C[0];
+  c1 = C[1];
+  c2 = C[2];
+  one = (__Float64x2_t) { 1.0, 1.0 };
+
+  z_0 = c0 * r_0 + c1;
+  z_1 = c0 * r_1 + c1;
+  r2_0 = r_0 * r_0;
+  r2_1 = r_1 * r_1;
+  y_0 = c2 * r_0 + one;
+  y_1 = c2 * r_1 + one;
+  y_0 = z_0 * r2_0 + y_0;
+  y_1 = z_1 * r2_1 + y_1;
+  y_0 = y_0 * vs_0;
+  y_1 = y_1 * vs_1;
+  result = pack_and_trunc (y_0, y_1);
+  return result;
+}
+
+#undef N
+#undef LIMIT
+#undef InvLog10_2N
+#undef C
+#undef SHIFT
+
+#endif
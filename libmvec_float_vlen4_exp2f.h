@@ -0,0 +1,168 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on exp2f.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_FLOAT_VLEN4_EXP2F_H
+#define _LIBMVEC_FLOAT_VLEN4_EXP2F_H
+
+#include <math.h>
+#include <stdint.h>
+#include <sysdeps/ieee754/flt-32/math_config.h>
+#include "libmvec_util.h"
+#include "libmvec_float_data.h"
+
+#define N (1 << EXP2F_TABLE_BITS)
+/* exp2f(x) overflows for x >= 128 and underflows to zero for x < -150.
+   Clamping x to [-LIMIT, LIMIT] keeps every result and the scale
+   computed in double stays in range, so the conversion to float
+   produces the inf, subnormal and zero results.  */
+#define LIMIT 200.0
+
+#define C __exp2f_v2df_data.poly
+#define SHIFT __exp2f_v2df_data.shift_scaled
+
+/* Constants of the table-free float kernel.  Adding and subtracting
+   F32_SHIFT rounds to an integer.  2^r ~= 1 + r * P(r) for
+   |r| <= 1/2.  */
+#define F32_SHIFT 0x1.8p23f
+#ifdef LIBMVEC_LOW_ACCURACY
+# define P0 0x1.62e42ap-1f
+# define P1 0x1.ebf9bcp-3f
+# define P2 0x1.c6b774p-5f
+# define P3 0x1.3cee72p-7f
+# define P4 0x1.5bbbc8p-10f
+#else
+# define P0 0x1.62e43p-1f
+# define P1 0x1.ebfbep-3f
+# define P2 0x1.c6af6cp-5f
+# define P3 0x1.3b2a54p-7f
+# define P4 0x1.5f089p-10f
+# define P5 0x1.44138ap-13f
+#endif
+
+static __always_inline __Float32x4_t
+__exp2f_v4sf(__Float32x4_t x)
+{
+  __Float32x4_t limit, result;
+  __Float64x2_t xd_0, xd_1, kd_0, kd_1, z_0, z_1, r_0, r_1, shift;
+  __Float64x2_t vs_0, vs_1, c0, c1, c2, y_0, y_1, r2_0, r2_1, one;
+  __Uint64x2_t ki_0, ki_1;
+
+  MVEC_STATS_VECTOR (EXP2F);
+
+  /* The nan propagating min and max leave nan lanes alone.  */
+  limit = (__Float32x4_t) { LIMIT, LIMIT, LIMIT, LIMIT };
+  x = __builtin_aarch64_smin_nanv4sf (x, limit);
+  x = __builtin_aarch64_smax_nanv4sf (x, -limit);
+
+  xd_0 = get_lo_and_extend (x);
+  xd_1 = get_hi_and_extend (x);
+
+  /* x = k/N + r with r in [-1/(2N), 1/(2N)] and int k.  Adding SHIFT
+     leaves k in the low bits of ki, where the table lookup uses it.  */
+  shift = SHIFT;
+  kd_0 = xd_0 + shift;
+  kd_1 = xd_1 + shift;
+  ki_0 = (__Uint64x2_t) kd_0;
+  ki_1 = (__Uint64x2_t) kd_1;
+  kd_0 -= shift;
+  kd_1 -= shift;
+  r_0 = xd_0 - kd_0;
+  r_1 = xd_1 - kd_1;
+
+  exp2f_scale_v2df (ki_0, ki_1, &vs_0, &vs_1);
+  c0 = C[0];
+  c1 = C[1];
+  c2 = C[2];
+  one = (__Float64x2_t) { 1.0, 1.0 };
+
+  z_0 = c0 * r_0 + c1;
+  z_1 = c0 * r_1 + c1;
+  r2_0 = r_0 * r_0;
+  r2_1 = r_1 * r_1;
+  y_0 = c2 * r_0 + one;
+  y_1 = c2 * r_1 + one;
+  y_0 = z_0 * r2_0 + y_0;
+  y_1 = z_1 * r2_1 + y_1;
+  y_0 = y_0 * vs_0;
+  y_1 = y_1 * vs_1;
+  result = pack_and_trunc (y_0, y_1);
+  return result;
+}
+
+static __always_inline __Float32x4_t
+__exp2f_dup(float c)
+{
+  return (__Float32x4_t) { c, c, c, c };
+}
+
+/* Table-free variant computed entirely in float, four lanes per
+   instruction instead of two, selected by building with
+   LIBMVEC_FLOAT32_KERNELS.  The largest error found is 1.11 ulp,
+   against 0.50 ulp for __exp2f_v4sf.  */
+static __always_inline __Float32x4_t
+__exp2f_f32_v4sf(__Float32x4_t x)
+{
+  __Float32x4_t limit, z, n, r, p, scale;
+  __Uint32x4_t e, special;
+
+  MVEC_STATS_VECTOR (EXP2F);
+
+  limit = __exp2f_dup (LIMIT);
+  x = __builtin_aarch64_smin_nanv4sf (x, limit);
+  x = __builtin_aarch64_smax_nanv4sf (x, -limit);
+
+  /* 2^x = 2^n 2^r with r = x - n in [-1/2, 1/2], exact.  */
+  z = x + F32_SHIFT;
+  n = z - F32_SHIFT;
+  e = (__Uint32x4_t) z << 23;
+  r = x - n;
+
+  /* p = 2^r - 1.  */
+#ifdef LIBMVEC_LOW_ACCURACY
+  p = __builtin_aarch64_fmav4sf (__exp2f_dup (P4), r, __exp2f_dup (P3));
+#else
+  p = __builtin_aarch64_fmav4sf (__exp2f_dup (P5), r, __exp2f_dup (P4));
+  p = __builtin_aarch64_fmav4sf (p, r, __exp2f_dup (P3));
+#endif
+  p = __builtin_aarch64_fmav4sf (p, r, __exp2f_dup (P2));
+  p = __builtin_aarch64_fmav4sf (p, r, __exp2f_dup (P1));
+  p = __builtin_aarch64_fmav4sf (p, r, __exp2f_dup (P0));
+  p = p * r;
+
+  special = (__Uint32x4_t) (__builtin_aarch64_absv4sf (n) > 126);
+  MVEC_STATS_LANES (EXP2F, RANGE, count_lanes_v4si (special));
+  scale = (__Float32x4_t) (e + 0x3f800000);
+  if (__glibc_unlikely (any_lane_v4si (special)))
+    return select_v4sf (special, expf_specialcase_v4sf (p, n, e),
+			__builtin_aarch64_fmav4sf (scale, p, scale));
+  return __builtin_aarch64_fmav4sf (scale, p, scale);
+}
+
+#undef N
+#undef LIMIT
+#undef C
+#undef SHIFT
+#undef F32_SHIFT
+#undef P0
+#undef P1
+#undef P2
+#undef P3
+#undef P4
+#undef P5
+
+#endif
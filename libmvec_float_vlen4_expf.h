@@ -0,0 +1,186 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on expf.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_FLOAT_VLEN4_EXPF_H
+#define _LIBMVEC_FLOAT_VLEN4_EXPF_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sysdeps/ieee754/flt-32/math_config.h>
+#include "libmvec_util.h"
+#include "libmvec_float_data.h"
+
+#define N (1 << EXP2F_TABLE_BITS)
+/* expf(x) overflows for x > 0x1.62e42ep6 and underflows to zero for
+   x < -0x1.9fe368p6.  Clamping x to [-LIMIT, LIMIT] keeps every result
+   and the scale computed in double stays in range, so the conversion
+   to float produces the inf, subnormal and zero results.  */
+#define LIMIT 150.0
+
+#define InvLn2N __exp2f_v2df_data.invln2_scaled
+#define C __exp2f_v2df_data.poly_scaled
+#define SHIFT __exp2f_v2df_data.shift
+
+/* Constants of the table-free float kernel.  Adding and subtracting
+   F32_SHIFT rounds to an integer.  exp(r) ~= 1 + r + r^2 * P(r) for
+   |r| <= Ln2/2.  */
+#define F32_SHIFT 0x1.8p23f
+#define F32_InvLn2 0x1.715476p+0f
+#define F32_Ln2hi 0x1.62e4p-1f
+#define F32_Ln2lo 0x1.7f7d1cp-20f
+#ifdef LIBMVEC_LOW_ACCURACY
+# define P0 0x1.fffdfcp-2f
+# define P1 0x1.5557aep-3f
+# define P2 0x1.572a16p-5f
+# define P3 0x1.1062dep-7f
+#else
+# define P0 0x1p-1f
+# define P1 0x1.5554dcp-3f
+# define P2 0x1.55551ap-5f
+# define P3 0x1.120b6ep-7f
+# define P4 0x1.6d110ap-10f
+#endif
+
+static __always_inline __Float32x4_t
+__expf_v4sf(__Float32x4_t x)
+{
+  __Float32x4_t limit, result;
+  __Float64x2_t xd_0, xd_1, vInvLn2N, z_0, z_1, vkd_0, vkd_1, r_0, r_1;
+  __Float64x2_t vs_0, vs_1, c0, c1, c2, y_0, y_1, r2_0, r2_1, one;
+  __Float64x2_t shift;
+  __Uint64x2_t ki_0, ki_1;
+
+  MVEC_STATS_VECTOR (EXPF);
+
+  /* The nan propagating min and max leave nan lanes alone.  */
+  limit = (__Float32x4_t) { LIMIT, LIMIT, LIMIT, LIMIT };
+  x = __builtin_aarch64_smin_nanv4sf (x, limit);
+  x = __builtin_aarch64_smax_nanv4sf (x, -limit);
+
+  xd_0 = get_lo_and_extend (x);
+  xd_1 = get_hi_and_extend (x);
+
+  vInvLn2N = InvLn2N;
+  /* x*N/Ln2 = k + r with r in [-1/2, 1/2] and int k.  */
+  z_0 = vInvLn2N * xd_0;
+  z_1 = vInvLn2N * xd_1;
+
+  /* Round z to int k by adding and subtracting SHIFT, which leaves k in
+     the low bits of ki.  The result is in [-150*N, 128*N], and the
+     rounding is ties-to-even, otherwise the magnitude of r could be
+     bigger which gives larger approximation error.  The table lookup
+     uses the low bits of ki in the vector registers.  */
+  shift = SHIFT;
+  vkd_0 = z_0 + shift;
+  vkd_1 = z_1 + shift;
+  ki_0 = (__Uint64x2_t) vkd_0;
+  ki_1 = (__Uint64x2_t) vkd_1;
+  vkd_0 -= shift;
+  vkd_1 -= shift;
+  r_0 = z_0 - vkd_0;
+  r_1 = z_1 - vkd_1;
+
+  /* exp(x) = 2^(k/N) * 2^(r/N) ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
+  exp2f_scale_v2df (ki_0, ki_1, &vs_0, &vs_1);
+  c0 = C[0];
+  c1 = C[1];
+  c2 = C[2];
+  one = (__Float64x2_t) { 1.0, 1.0 };
+
+  z_0 = c0 * r_0 + c1;
+  z_1 = c0 * r_1 + c1;
+  r2_0 = r_0 * r_0;
+  r2_1 = r_1 * r_1;
+  y_0 = c2 * r_0 + one;
+  y_1 = c2 * r_1 + one;
+  y_0 = z_0 * r2_0 + y_0;
+  y_1 = z_1 * r2_1 + y_1;
+  y_0 = y_0 * vs_0;
+  y_1 = y_1 * vs_1;
+  result = pack_and_trunc (y_0, y_1);
+  return result;
+}
+
+static __always_inline __Float32x4_t
+__expf_dup(float c)
+{
+  return (__Float32x4_t) { c, c, c, c };
+}
+
+/* Table-free variant computed entirely in float, four lanes per
+   instruction instead of two, selected by building with
+   LIBMVEC_FLOAT32_KERNELS.  The largest error found is 1.06 ulp,
+   against 0.50 ulp for __expf_v4sf.  */
+static __always_inline __Float32x4_t
+__expf_f32_v4sf(__Float32x4_t x)
+{
+  __Float32x4_t limit, z, n, r, r2, p, scale;
+  __Uint32x4_t e, special;
+
+  MVEC_STATS_VECTOR (EXPF);
+
+  limit = __expf_dup (LIMIT);
+  x = __builtin_aarch64_smin_nanv4sf (x, limit);
+  x = __builtin_aarch64_smax_nanv4sf (x, -limit);
+
+  /* exp(x) = 2^n exp(r) with r = x - n*Ln2 in [-Ln2/2, Ln2/2].  */
+  z = __builtin_aarch64_fmav4sf (x, __expf_dup (F32_InvLn2),
+				 __expf_dup (F32_SHIFT));
+  n = z - F32_SHIFT;
+  e = (__Uint32x4_t) z << 23;
+  r = __builtin_aarch64_fmav4sf (-n, __expf_dup (F32_Ln2hi), x);
+  r = __builtin_aarch64_fmav4sf (-n, __expf_dup (F32_Ln2lo), r);
+
+  /* p = exp(r) - 1.  */
+  r2 = r * r;
+#ifdef LIBMVEC_LOW_ACCURACY
+  p = __builtin_aarch64_fmav4sf (__expf_dup (P3), r, __expf_dup (P2));
+#else
+  p = __builtin_aarch64_fmav4sf (__expf_dup (P4), r, __expf_dup (P3));
+  p = __builtin_aarch64_fmav4sf (p, r, __expf_dup (P2));
+#endif
+  p = __builtin_aarch64_fmav4sf (p, r, __expf_dup (P1));
+  p = __builtin_aarch64_fmav4sf (p, r, __expf_dup (P0));
+  p = __builtin_aarch64_fmav4sf (p, r2, r);
+
+  special = (__Uint32x4_t) (__builtin_aarch64_absv4sf (n) > 126);
+  MVEC_STATS_LANES (EXPF, RANGE, count_lanes_v4si (special));
+  scale = (__Float32x4_t) (e + 0x3f800000);
+  if (__glibc_unlikely (any_lane_v4si (special)))
+    return select_v4sf (special, expf_specialcase_v4sf (p, n, e),
+			__builtin_aarch64_fmav4sf (scale, p, scale));
+  return __builtin_aarch64_fmav4sf (scale, p, scale);
+}
+
+#undef N
+#undef LIMIT
+#undef InvLn2N
+#undef C
+#undef SHIFT
+#undef F32_SHIFT
+#undef F32_InvLn2
+#undef F32_Ln2hi
+#undef F32_Ln2lo
+#undef P0
+#undef P1
+#undef P2
+#undef P3
+#undef P4
+
+#endif
@@ -0,0 +1,146 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on expf.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_FLOAT_VLEN4_EXPM1F_H
+#define _LIBMVEC_FLOAT_VLEN4_EXPM1F_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sysdeps/ieee754/flt-32/math_config.h>
+#include "libmvec_util.h"
+#include "libmvec_float_data.h"
+
+#define N (1 << EXP2F_TABLE_BITS)
+/* expm1f(x) overflows for x > 0x1.62e42ep6 and rounds to -1 for
+   x < -0x1.154246p4.  Clamping x to [-LIMIT, LIMIT] keeps every result
+   and the scale computed in double stays in range, so the conversion
+   to float produces the inf results.  */
+#define LIMIT 150.0
+
+/* Lanes with |x| < SMALL use the Taylor series, where s - 1 would
+   cancel.  */
+#define SMALL 0x1p-4f
+
+#define InvLn2N __exp2f_v2df_data.invln2_scaled
+#define C __exp2f_v2df_data.poly_scaled
+#define SHIFT __exp2f_v2df_data.shift
+
+/* expm1(x) for |x| < SMALL, in double.  The series is cut after x^6,
+   the first omitted term is below 2^-36 relative.  */
+static __always_inline __Float64x2_t
+__expm1f_small(__Float64x2_t x)
+{
+  __Float64x2_t p;
+
+  p = 0x1.6c16c16c16c17p-10 * x + 0x1.1111111111111p-7;
+  p = p * x + 0x1.5555555555555p-5;
+  p = p * x + 0x1.5555555555555p-3;
+  p = p * x + 0.5;
+  return x + x * x * p;
+}
+
+static __always_inline __Float32x4_t
+__expm1f_v4sf(__Float32x4_t x)
+{
+  __Float32x4_t limit, result;
+  __Float64x2_t xd_0, xd_1, vInvLn2N, z_0, z_1, vkd_0, vkd_1, r_0, r_1;
+  __Float64x2_t vs_0, vs_1, c0, c1, c2, y_0, y_1, r2_0, r2_1, one;
+  __Float64x2_t shift;
+  __Uint64x2_t ki_0, ki_1;
+  __Uint32x4_t small;
+
+  MVEC_STATS_VECTOR (EXPM1F);
+
+  small = (__Uint32x4_t) (__builtin_aarch64_absv4sf (x) < SMALL);
+  if (!any_lane_v4si (~small))
+    {
+      y_0 = __expm1f_small (get_lo_and_extend (x));
+      y_1 = __expm1f_small (get_hi_and_extend (x));
+      /* Keep the sign of expm1f(-0).  */
+      return select_v4sf ((__Uint32x4_t) (x == 0), x,
+			  pack_and_trunc (y_0, y_1));
+    }
+
+  /* The nan propagating min and max leave nan lanes alone.  */
+  limit = (__Float32x4_t) { LIMIT, LIMIT, LIMIT, LIMIT };
+  x = __builtin_aarch64_smin_nanv4sf (x, limit);
+  x = __builtin_aarch64_smax_nanv4sf (x, -limit);
+
+  xd_0 = get_lo_and_extend (x);
+  xd_1 = get_hi_and_extend (x);
+
+  vInvLn2N = InvLn2N;
+  /* x*N/Ln2 = k + r with r in [-1/2, 1/2] and int k.  */
+  z_0 = vInvLn2N * xd_0;
+  z_1 = vInvLn2N * xd_1;
+
+  /* Round z to int k by adding and subtracting SHIFT, which leaves k in
+     the low bits of ki.  The result is in [-150*N, 128*N], and the
+     rounding is ties-to-even, otherwise the magnitude of r could be
+     bigger which gives larger approximation error.  The table lookup
+     uses the low bits of ki in the vector registers.  */
+  shift = SHIFT;
+  vkd_0 = z_0 + shift;
+  vkd_1 = z_1 + shift;
+  ki_0 = (__Uint64x2_t) vkd_0;
+  ki_1 = (__Uint64x2_t) vkd_1;
+  vkd_0 -= shift;
+  vkd_1 -= shift;
+  r_0 = z_0 - vkd_0;
+  r_1 = z_1 - vkd_1;
+
+  /* exp(x) - 1 = 2^(k/N) * 2^(r/N) - 1
+		~= (s - 1) + s * (C0*r^3 + C1*r^2 + C2*r) */
+  exp2f_scale_v2df (ki_0, ki_1, &vs_0, &vs_1);
+  c0 = C[0];
+  c1 = C[1];
+  c2 = C[2];
+  one = (__Float64x2_t) { 1.0, 1.0 };
+
+  z_0 = c0 * r_0 + c1;
+  z_1 = c0 * r_1 + c1;
+  r2_0 = r_0 * r_0;
+  r2_1 = r_1 * r_1;
+  y_0 = c2 * r_0;
+  y_1 = c2 * r_1;
+  y_0 = z_0 * r2_0 + y_0;
+  y_1 = z_1 * r2_1 + y_1;
+  /* s - 1 is exact for s >= 0.5 and its rounding error is far below
+     the float precision of the result otherwise.  */
+  y_0 = y_0 * vs_0 + (vs_0 - one);
+  y_1 = y_1 * vs_1 + (vs_1 - one);
+  result = pack_and_trunc (y_0, y_1);
+  if (any_lane_v4si (small))
+    {
+      y_0 = __expm1f_small (get_lo_and_extend (x));
+      y_1 = __expm1f_small (get_hi_and_extend (x));
+      result = select_v4sf (small, pack_and_trunc (y_0, y_1), result);
+      result = select_v4sf ((__Uint32x4_t) (x == 0), x, result);
+    }
+  return result;
+}
+
+#undef N
+#undef LIMIT
+#undef SMALL
+#undef InvLn2N
+#undef C
+#undef SHIFT
+
+#endif
@@ -0,0 +1,139 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on logf.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_FLOAT_VLEN4_LOG10F_H
+#define _LIBMVEC_FLOAT_VLEN4_LOG10F_H
+
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+#include <sysdeps/ieee754/flt-32/math_config.h>
+#include "libmvec_util.h"
+#include "libmvec_float_data.h"
+
+#define T __logf_tbl_data
+#define A __logf_v2df_data.poly
+#define Ln2 __logf_v2df_data.ln2
+#define N (1 << LOGF_TABLE_BITS)
+#define OFF 0x3f330000
+#define InvLn10 0x1.bcb7b1526e50ep-2
+
+/* Results for the lanes that are not positive normal numbers:
+   log10f(+-0) = -inf, log10f(x < 0) = nan, log10f(inf) = inf,
+   log10f(nan) = nan.  Positive lanes keep the value computed by the
+   caller.  */
+static __always_inline __Float32x4_t
+__log10f_special (__Float32x4_t x, __Float32x4_t y)
+{
+  __Float32x4_t e;
+  __Uint32x4_t fix;
+
+  fix = (__Uint32x4_t) ~((x > 0) & (x <= FLT_MAX));
+  e = select_v4sf ((__Uint32x4_t) (x == 0),
+		   (__Float32x4_t) { -INFINITY, -INFINITY, -INFINITY, -INFINITY },
+		   x + x);
+  e = select_v4sf ((__Uint32x4_t) (x < 0),
+		   (__Float32x4_t) { NAN, NAN, NAN, NAN }, e);
+  return select_v4sf (fix, e, y);
+}
+
+static __always_inline __Float32x4_t
+__log10f_v4sf(__Float32x4_t x)
+{
+  __Float64x2_t vz_0, vz_1, vinvc_0, vinvc_1, vlogc_0, vlogc_1;
+  __Float64x2_t vk_0, vk_1, vLn2, vInvLn10, va0, va1, va2, vone;
+  __Float64x2_t r_0, r_1, y0_0, y0_1, r2_0, r2_1, y_0, y_1;
+  __Float32x4_t result, xn;
+  __Float32x4_t z, k;
+  __Uint32x4_t ix, tmp, i, special, sub, bias;
+
+  MVEC_STATS_VECTOR (LOG10F);
+
+  /* Zero, negative, subnormal, inf and nan lanes.  Subnormal inputs
+     are normalized so that their exponent becomes negative and go
+     through the table code with the other lanes, the rest get their
+     result from __log10f_special at the end.  */
+  special = (__Uint32x4_t) ~((x >= FLT_MIN) & (x <= FLT_MAX));
+  MVEC_STATS_LANES (LOG10F, SPECIAL, count_lanes_v4si (special));
+  xn = x;
+  bias = (__Uint32x4_t) { 0, 0, 0, 0 };
+  if (__glibc_unlikely (any_lane_v4si (special)))
+    {
+      sub = (__Uint32x4_t) ((x > 0) & (x < FLT_MIN));
+      xn = select_v4sf (sub, x * 0x1p23f, x);
+      bias = sub & (23 << 23);
+    }
+
+  /* x = 2^k z with z in [OFF, 2 OFF), the top bits of z - OFF select
+     the table entry, which TBL looks up without moving the indices
+     out of the vector registers.  z and k are exact in float and
+     widened to double.  */
+  ix = (__Uint32x4_t) xn - bias;
+  tmp = ix - OFF;
+  i = (tmp >> (23 - LOGF_TABLE_BITS)) % N;
+  z = (__Float32x4_t) (ix - (tmp & 0xff800000));
+  k = __builtin_aarch64_floatv4siv4sf ((__Int32x4_t) tmp >> 23);
+  logf_lookup_v2df (&T, i, &vinvc_0, &vinvc_1, &vlogc_0, &vlogc_1);
+
+  vz_0 = get_lo_and_extend (z);
+  vz_1 = get_hi_and_extend (z);
+  vk_0 = get_lo_and_extend (k);
+  vk_1 = get_hi_and_extend (k);
+  vone = (__Float64x2_t) { 1.0, 1.0 };
+  vLn2 = Ln2;
+  vInvLn10 = (__Float64x2_t) { InvLn10, InvLn10 };
+  va0 = A[0];
+  va1 = A[1];
+  va2 = A[2];
+
+   /* log(x) = log1p(z/c-1) + log(c) + k*Ln2 */
+  r_0 = vz_0 * vinvc_0 - vone;
+  r_1 = vz_1 * vinvc_1 - vone;
+  y0_0 = vlogc_0 + vk_0 * vLn2;
+  y0_1 = vlogc_1 + vk_1 * vLn2;
+  /* Pipelined polynomial evaluation to approximate log1p(r).  */
+  r2_0 = r_0 * r_0;
+  r2_1 = r_1 * r_1;
+  y_0 = va1 * r_0 + va2;
+  y_1 = va1 * r_1 + va2;
+  y_0 = va0 * r2_0 + y_0;
+  y_1 = va0 * r2_1 + y_1;
+  y_0 = y_0 * r2_0 + (y0_0 + r_0);
+  y_1 = y_1 * r2_1 + (y0_1 + r_1);
+  /* The product is rounded in double, far below the float precision
+     of the result.  */
+  y_0 = y_0 * vInvLn10;
+  y_1 = y_1 * vInvLn10;
+  result = pack_and_trunc (y_0, y_1);
+
+  /* log10f(1) is exactly +0 in every rounding mode.  */
+  result = select_v4sf ((__Uint32x4_t) (x == 1.0f),
+			(__Float32x4_t) { 0.0f, 0.0f, 0.0f, 0.0f }, result);
+  if (__glibc_unlikely (any_lane_v4si (special)))
+    return __log10f_special (x, result);
+  return result;
+}
+
+#undef T
+#undef A
+#undef Ln2
+#undef N
+#undef OFF
+#undef InvLn10
+
+#endif
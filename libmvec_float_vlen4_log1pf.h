@@ -0,0 +1,170 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on logf.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_FLOAT_VLEN4_LOG1PF_H
+#define _LIBMVEC_FLOAT_VLEN4_LOG1PF_H
+
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+#include <sysdeps/ieee754/flt-32/math_config.h>
+#include "libmvec_util.h"
+#include "libmvec_float_data.h"
+
+#define T __logf_tbl_data
+#define A __logf_v2df_data.poly
+#define Ln2 __logf_v2df_data.ln2
+#define N (1 << LOGF_TABLE_BITS)
+#define OFF 0x3f330000
+
+/* Lanes with |x| < SMALL use the Taylor series.  The table code loses
+   up to 0.82 ulp just above 2^-4, where log1p(x) is small compared to
+   the rounding error of the table entries, the series stays within
+   0.56 ulp up to 2^-3.  */
+#define SMALL 0x1p-3f
+
+/* log1p(x) for |x| < SMALL, in double.  The series is cut after x^10,
+   the first omitted term is below 2^-33 relative.  */
+static __always_inline __Float64x2_t
+__log1pf_small(__Float64x2_t x)
+{
+  __Float64x2_t p;
+
+  p = -0x1.999999999999ap-4 * x + 0x1.c71c71c71c71cp-4;
+  p = p * x - 0.125;
+  p = p * x + 0x1.2492492492492p-3;
+  p = p * x - 0x1.5555555555555p-3;
+  p = p * x + 0x1.999999999999ap-3;
+  p = p * x - 0.25;
+  p = p * x + 0x1.5555555555555p-2;
+  p = p * x - 0.5;
+  return x + x * x * p;
+}
+
+/* Results for the lanes outside (-1, inf): log1pf(-1) = -inf,
+   log1pf(x < -1) = nan, log1pf(inf) = inf, log1pf(nan) = nan.  The
+   other lanes keep the value computed by the caller.  */
+static __always_inline __Float32x4_t
+__log1pf_special (__Float32x4_t x, __Float32x4_t y)
+{
+  __Float32x4_t e;
+  __Uint32x4_t fix;
+
+  fix = (__Uint32x4_t) ~((x > -1.0f) & (x <= FLT_MAX));
+  e = select_v4sf ((__Uint32x4_t) (x == -1.0f),
+		   (__Float32x4_t) { -INFINITY, -INFINITY, -INFINITY, -INFINITY },
+		   x + x);
+  e = select_v4sf ((__Uint32x4_t) (x < -1.0f),
+		   (__Float32x4_t) { NAN, NAN, NAN, NAN }, e);
+  return select_v4sf (fix, e, y);
+}
+
+static __always_inline __Float32x4_t
+__log1pf_v4sf(__Float32x4_t x)
+{
+  __Float64x2_t vz_0, vz_1, vinvc_0, vinvc_1, vlogc_0, vlogc_1;
+  __Float64x2_t vk_0, vk_1, vLn2, va0, va1, va2, vone;
+  __Float64x2_t r_0, r_1, y0_0, y0_1, r2_0, r2_1, y_0, y_1;
+  __Float64x2_t ud_0, ud_1, c_0, c_1;
+  __Float32x4_t result, u;
+  __Float32x4_t z, k;
+  __Uint32x4_t ix, tmp, i, special, small;
+
+  MVEC_STATS_VECTOR (LOG1PF);
+
+  small = (__Uint32x4_t) (__builtin_aarch64_absv4sf (x) < SMALL);
+  if (!any_lane_v4si (~small))
+    {
+      y_0 = __log1pf_small (get_lo_and_extend (x));
+      y_1 = __log1pf_small (get_hi_and_extend (x));
+      /* Keep the sign of log1pf(-0).  */
+      return select_v4sf ((__Uint32x4_t) (x == 0), x,
+			  pack_and_trunc (y_0, y_1));
+    }
+
+  /* Lanes outside (-1, inf) get their result from __log1pf_special at
+     the end, the table code below only needs to stay in bounds for
+     them.  */
+  special = (__Uint32x4_t) ~((x > -1.0f) & (x <= FLT_MAX));
+  MVEC_STATS_LANES (LOG1PF, SPECIAL, count_lanes_v4si (special));
+
+  /* log1p(x) = log(u) + c/u with u = 1 + x rounded to float, which is
+     a positive normal number, and c = 1 + x - u computed in double.  */
+  vone = (__Float64x2_t) { 1.0, 1.0 };
+  u = 1.0f + x;
+  ud_0 = get_lo_and_extend (u);
+  ud_1 = get_hi_and_extend (u);
+  c_0 = (vone - ud_0) + get_lo_and_extend (x);
+  c_1 = (vone - ud_1) + get_hi_and_extend (x);
+
+  /* u = 2^k z with z in [OFF, 2 OFF), the top bits of z - OFF select
+     the table entry, which TBL looks up without moving the indices
+     out of the vector registers.  z and k are exact in float and
+     widened to double.  */
+  ix = (__Uint32x4_t) u;
+  tmp = ix - OFF;
+  i = (tmp >> (23 - LOGF_TABLE_BITS)) % N;
+  z = (__Float32x4_t) (ix - (tmp & 0xff800000));
+  k = __builtin_aarch64_floatv4siv4sf ((__Int32x4_t) tmp >> 23);
+  logf_lookup_v2df (&T, i, &vinvc_0, &vinvc_1, &vlogc_0, &vlogc_1);
+
+  vz_0 = get_lo_and_extend (z);
+  vz_1 = get_hi_and_extend (z);
+  vk_0 = get_lo_and_extend (k);
+  vk_1 = get_hi_and_extend (k);
+  vLn2 = Ln2;
+  va0 = A[0];
+  va1 = A[1];
+  va2 = A[2];
+
+   /* log(u) = log1p(z/c-1) + log(c) + k*Ln2 */
+  r_0 = vz_0 * vinvc_0 - vone;
+  r_1 = vz_1 * vinvc_1 - vone;
+  y0_0 = vlogc_0 + vk_0 * vLn2 + c_0 / ud_0;
+  y0_1 = vlogc_1 + vk_1 * vLn2 + c_1 / ud_1;
+  /* Pipelined polynomial evaluation to approximate log1p(r).  */
+  r2_0 = r_0 * r_0;
+  r2_1 = r_1 * r_1;
+  y_0 = va1 * r_0 + va2;
+  y_1 = va1 * r_1 + va2;
+  y_0 = va0 * r2_0 + y_0;
+  y_1 = va0 * r2_1 + y_1;
+  y_0 = y_0 * r2_0 + (y0_0 + r_0);
+  y_1 = y_1 * r2_1 + (y0_1 + r_1);
+  result = pack_and_trunc (y_0, y_1);
+
+  if (any_lane_v4si (small))
+    {
+      y_0 = __log1pf_small (get_lo_and_extend (x));
+      y_1 = __log1pf_small (get_hi_and_extend (x));
+      result = select_v4sf (small, pack_and_trunc (y_0, y_1), result);
+      result = select_v4sf ((__Uint32x4_t) (x == 0), x, result);
+    }
+  if (__glibc_unlikely (any_lane_v4si (special)))
+    return __log1pf_special (x, result);
+  return result;
+}
+
+#undef T
+#undef A
+#undef Ln2
+#undef N
+#undef OFF
+#undef SMALL
+
+#endif
@@ -0,0 +1,228 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on log2f.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_FLOAT_VLEN4_LOG2F_H
+#define _LIBMVEC_FLOAT_VLEN4_LOG2F_H
+
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+#include <sysdeps/ieee754/flt-32/math_config.h>
+#include "libmvec_util.h"
+#include "libmvec_float_data.h"
+
+#define N (1 << LOG2F_TABLE_BITS)
+#define T __log2f_tbl_data
+#define A __log2f_v2df_data.poly
+#define OFF 0x3f330000
+
+/* Constants of the table-free float kernel.  The mantissa is reduced
+   to [F32_OFF, 2*F32_OFF) = [2/3, 4/3) and log1p(r) ~= r + r^2 * P(r)
+   for |r| <= 1/3.  Adding and subtracting F32_SHIFT converts the
+   exponent to float.  */
+#define F32_OFF 0x3f2aaaab
+#define F32_SHIFT 0x1.8p23f
+#ifdef LIBMVEC_LOW_ACCURACY
+# define P0 -0x1.fffff6p-2f
+# define P1 0x1.55554ep-2f
+# define P2 -0x1.000b06p-2f
+# define P3 0x1.99acecp-3f
+# define P4 -0x1.5192f4p-3f
+# define P5 0x1.2126d2p-3f
+# define P6 -0x1.34072cp-3f
+# define P7 0x1.12f584p-3f
+#else
+# define P0 -0x1p-1f
+# define P1 0x1.55552cp-2f
+# define P2 -0x1.ffffb6p-3f
+# define P3 0x1.99bf86p-3f
+# define P4 -0x1.557832p-3f
+# define P5 0x1.1fdcfp-3f
+# define P6 -0x1.f75896p-4f
+# define P7 0x1.1990bcp-3f
+# define P8 -0x1.fcd036p-4f
+#endif
+#define F32_InvLn2 0x1.715476p+0f
+
+/* Results for the lanes that are not positive normal numbers:
+   log2f(+-0) = -inf, log2f(x < 0) = nan, log2f(inf) = inf,
+   log2f(nan) = nan.  Positive lanes keep the value computed by the
+   caller.  */
+static __always_inline __Float32x4_t
+__log2f_special (__Float32x4_t x, __Float32x4_t y)
+{
+  __Float32x4_t e;
+  __Uint32x4_t fix;
+
+  fix = (__Uint32x4_t) ~((x > 0) & (x <= FLT_MAX));
+  e = select_v4sf ((__Uint32x4_t) (x == 0),
+		   (__Float32x4_t) { -INFINITY, -INFINITY, -INFINITY, -INFINITY },
+		   x + x);
+  e = select_v4sf ((__Uint32x4_t) (x < 0),
+		   (__Float32x4_t) { NAN, NAN, NAN, NAN }, e);
+  return select_v4sf (fix, e, y);
+}
+
+static __always_inline __Float32x4_t
+__log2f_v4sf(__Float32x4_t x)
+{
+  __Float64x2_t vz_0, vz_1, vinvc_0, vinvc_1, vlogc_0, vlogc_1;
+  __Float64x2_t vk_0, vk_1, va0, va1, va2, va3, vone;
+  __Float64x2_t r_0, r_1, y0_0, y0_1, r2_0, r2_1, y_0, y_1, p_0, p_1;
+  __Float32x4_t result, xn;
+  __Float32x4_t z, k;
+  __Uint32x4_t ix, tmp, i, special, sub, bias;
+
+  MVEC_STATS_VECTOR (LOG2F);
+
+  /* Zero, negative, subnormal, inf and nan lanes.  Subnormal inputs
+     are normalized so that their exponent becomes negative and go
+     through the table code with the other lanes, the rest get their
+     result from __log2f_special at the end.  */
+  special = (__Uint32x4_t) ~((x >= FLT_MIN) & (x <= FLT_MAX));
+  MVEC_STATS_LANES (LOG2F, SPECIAL, count_lanes_v4si (special));
+  xn = x;
+  bias = (__Uint32x4_t) { 0, 0, 0, 0 };
+  if (__glibc_unlikely (any_lane_v4si (special)))
+    {
+      sub = (__Uint32x4_t) ((x > 0) & (x < FLT_MIN));
+      xn = select_v4sf (sub, x * 0x1p23f, x);
+      bias = sub & (23 << 23);
+    }
+
+  /* x = 2^k z with z in [OFF, 2 OFF), the top bits of z - OFF select
+     the table entry, which TBL looks up without moving the indices
+     out of the vector registers.  z and k are exact in float and
+     widened to double.  */
+  ix = (__Uint32x4_t) xn - bias;
+  tmp = ix - OFF;
+  i = (tmp >> (23 - LOG2F_TABLE_BITS)) % N;
+  z = (__Float32x4_t) (ix - (tmp & 0xff800000));
+  k = __builtin_aarch64_floatv4siv4sf ((__Int32x4_t) tmp >> 23);
+  logf_lookup_v2df (&T, i, &vinvc_0, &vinvc_1, &vlogc_0, &vlogc_1);
+
+  vz_0 = get_lo_and_extend (z);
+  vz_1 = get_hi_and_extend (z);
+  vk_0 = get_lo_and_extend (k);
+  vk_1 = get_hi_and_extend (k);
+  vone = (__Float64x2_t) { 1.0, 1.0 };
+  va0 = A[0];
+  va1 = A[1];
+  va2 = A[2];
+  va3 = A[3];
+
+  /* log2(x) = log1p(z/c-1)/ln2 + log2(c) + k */
+  r_0 = vz_0 * vinvc_0 - vone;
+  r_1 = vz_1 * vinvc_1 - vone;
+  y0_0 = vlogc_0 + vk_0;
+  y0_1 = vlogc_1 + vk_1;
+
+  /* Pipelined polynomial evaluation to approximate log1p(r)/ln2.  */
+  r2_0 = r_0 * r_0;
+  r2_1 = r_1 * r_1;
+  y_0 = va1 * r_0 + va2;
+  y_1 = va1 * r_1 + va2;
+  y_0 = va0 * r2_0 + y_0;
+  y_1 = va0 * r2_1 + y_1;
+  p_0 = va3 * r_0 + y0_0;
+  p_1 = va3 * r_1 + y0_1;
+  y_0 = y_0 * r2_0 + p_0;
+  y_1 = y_1 * r2_1 + p_1;
+  result = pack_and_trunc (y_0, y_1);
+
+  /* log2f(1) is exactly +0 in every rounding mode.  */
+  result = select_v4sf ((__Uint32x4_t) (x == 1.0f),
+			(__Float32x4_t) { 0.0f, 0.0f, 0.0f, 0.0f }, result);
+  if (__glibc_unlikely (any_lane_v4si (special)))
+    return __log2f_special (x, result);
+  return result;
+}
+
+static __always_inline __Float32x4_t
+__log2f_dup(float c)
+{
+  return (__Float32x4_t) { c, c, c, c };
+}
+
+/* Table-free variant computed entirely in float, four lanes per
+   instruction instead of two, selected by building with
+   LIBMVEC_FLOAT32_KERNELS.  The largest error found is 1.79 ulp,
+   against 0.75 ulp for __log2f_v4sf.  */
+static __always_inline __Float32x4_t
+__log2f_f32_v4sf(__Float32x4_t x)
+{
+  __Float32x4_t xn, n, r, r2, p, y;
+  __Uint32x4_t special, sub, bias, u;
+
+  MVEC_STATS_VECTOR (LOG2F);
+
+  /* Subnormal lanes are normalized as in __log2f_v4sf.  */
+  special = (__Uint32x4_t) ~((x >= FLT_MIN) & (x <= FLT_MAX));
+  MVEC_STATS_LANES (LOG2F, SPECIAL, count_lanes_v4si (special));
+  xn = x;
+  bias = (__Uint32x4_t) { 0, 0, 0, 0 };
+  if (__glibc_unlikely (any_lane_v4si (special)))
+    {
+      sub = (__Uint32x4_t) ((x > 0) & (x < FLT_MIN));
+      xn = select_v4sf (sub, x * 0x1p23f, x);
+      bias = sub & (23 << 23);
+    }
+
+  /* log2(x) = n + log1p(r)/Ln2 with r = m - 1 and m in [2/3, 4/3).  */
+  u = (__Uint32x4_t) xn - bias - F32_OFF;
+  n = (__Float32x4_t) (((__Int32x4_t) u >> 23) + 0x4b400000) - F32_SHIFT;
+  r = (__Float32x4_t) ((u & 0x007fffff) + F32_OFF) - 1.0f;
+
+  r2 = r * r;
+#ifdef LIBMVEC_LOW_ACCURACY
+  p = __builtin_aarch64_fmav4sf (__log2f_dup (P7), r, __log2f_dup (P6));
+#else
+  p = __builtin_aarch64_fmav4sf (__log2f_dup (P8), r, __log2f_dup (P7));
+  p = __builtin_aarch64_fmav4sf (p, r, __log2f_dup (P6));
+#endif
+  p = __builtin_aarch64_fmav4sf (p, r, __log2f_dup (P5));
+  p = __builtin_aarch64_fmav4sf (p, r, __log2f_dup (P4));
+  p = __builtin_aarch64_fmav4sf (p, r, __log2f_dup (P3));
+  p = __builtin_aarch64_fmav4sf (p, r, __log2f_dup (P2));
+  p = __builtin_aarch64_fmav4sf (p, r, __log2f_dup (P1));
+  p = __builtin_aarch64_fmav4sf (p, r, __log2f_dup (P0));
+  y = __builtin_aarch64_fmav4sf (p, r2, r);
+  y = __builtin_aarch64_fmav4sf (y, __log2f_dup (F32_InvLn2), n);
+  if (__glibc_unlikely (any_lane_v4si (special)))
+    return __log2f_special (x, y);
+  return y;
+}
+
+#undef N
+#undef T
+#undef A
+#undef OFF
+#undef F32_OFF
+#undef F32_SHIFT
+#undef P0
+#undef P1
+#undef P2
+#undef P3
+#undef P4
+#undef P5
+#undef P6
+#undef P7
+#undef P8
+#undef F32_InvLn2
+
+#endif
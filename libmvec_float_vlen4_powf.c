@@ -14,56 +14,17 @@
  * limitations under the License.
  */
 
-#include <math.h>
-#include "libmvec_util.h"
+#include "libmvec_float_vlen4_powf.h"
 
-extern __Float32x4_t _ZGVnN4v_exp2f(__Float32x4_t);
-extern __Float32x4_t _ZGVnN4v_log2f(__Float32x4_t);
-
-__AARCH64_VECTOR_PCS_ATTR static __Float32x4_t
-__scalar_powf(__Float32x4_t x, __Float32x4_t y)
-{
-  return (__Float32x4_t) { powf(x[0],y[0]), powf(x[1],y[1]),
-			   powf(x[2],y[2]), powf(x[3],y[3]) };
-}
-
-#define CUTOFF 80.0
+LIBMVEC_ENTRY (__Float32x4_t, _ZGVnN4vv_powf,
+	       (__Float32x4_t x, __Float32x4_t y), (x, y), __powf_v4sf)
+weak_alias (_ZGVnN4vv_powf, _ZGVnN4vv___powf_finite)
 
 __AARCH64_VECTOR_PCS_ATTR __Float32x4_t
-_ZGVnN4vv_powf(__Float32x4_t x, __Float32x4_t y)
+_ZGVnM4vv_powf(__Float32x4_t x, __Float32x4_t y, __Uint32x4_t mask)
 {
-  float x_0, x_1, x_2, x_3, y_0, y_1, y_2, y_3;
-  float f, g;
-
-  x_0 = x[0];
-  x_1 = x[1];
-  x_2 = x[2];
-  x_3 = x[3];
-  y_0 = y[0];
-  y_1 = y[1];
-  y_2 = y[2];
-  y_3 = y[3];
-
-  if (__glibc_unlikely(!__builtin_isnormal (x_0) || !__builtin_isnormal (x_1)
-		    || !__builtin_isnormal (x_2) || !__builtin_isnormal (x_3)))
-    return __scalar_powf (x, y);
-
-  if (__glibc_unlikely(!__builtin_isnormal (y_0) || !__builtin_isnormal (y_1)
-		    || !__builtin_isnormal (y_2) || !__builtin_isnormal (y_3)))
-    return __scalar_powf (x, y);
-
-  f = __builtin_aarch64_reduc_smin_scal_v4sf (x);
-  g = __builtin_aarch64_reduc_smin_scal_v4sf (y);
-
-  if (f < 0.0 || g < 0.0)
-    return __scalar_powf (x, y);
-
-  f = __builtin_aarch64_reduc_smax_scal_v4sf (x);
-  g = __builtin_aarch64_reduc_smax_scal_v4sf (y);
-
-  if (f > CUTOFF || g > CUTOFF)
-    return __scalar_powf (x, y);
-
-  return (_ZGVnN4v_exp2f (y * _ZGVnN4v_log2f (x)));
+  return _ZGVnN4vv_powf (mask_v4sf (mask, x, 1.0f), mask_v4sf (mask, y, 1.0f));
 }
-weak_alias (_ZGVnN4vv_powf, _ZGVnN4vv___powf_finite)
+weak_alias (_ZGVnM4vv_powf, _ZGVnM4vv___powf_finite)
+
+LIBMVEC_ARRAY2_V4SF (mvec_powf, __powf_v4sf)
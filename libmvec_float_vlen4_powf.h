@@ -0,0 +1,196 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on powf.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_FLOAT_VLEN4_POWF_H
+#define _LIBMVEC_FLOAT_VLEN4_POWF_H
+
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+#include <sysdeps/ieee754/flt-32/math_config.h>
+#include "libmvec_util.h"
+#include "libmvec_float_data.h"
+
+#define N (1 << POWF_LOG2_TABLE_BITS)
+#define T __powf_log2_tbl_data
+#define A __powf_log2_v2df_data.poly
+#define OFF 0x3f330000
+
+#define C __exp2f_v2df_data.poly
+#define SHIFT __exp2f_v2df_data.shift_scaled
+
+/* y*log2(x) is kept in double between the two stages.  Clamping it to
+   [-LIMIT, LIMIT] keeps every result, exp2f overflows for 128 and
+   underflows to zero below -150, and the scale stays in range so the
+   conversion to float produces the inf, subnormal and zero results.  */
+#define LIMIT 200.0
+
+/* xd = k/N + r with r in [-1/(2N), 1/(2N)] and int k on the two lanes
+   of vxd_n.  Adding SHIFT leaves k in the low bits of ki, from which
+   exp2f_scale_v2df computes s = 2^(k/N) for all four lanes.  */
+#define CALC_EXP2(__n) \
+	vkd_##__n = vxd_##__n + vshift; \
+	ki_##__n = (__Uint64x2_t) vkd_##__n; \
+	vkd_##__n -= vshift; \
+	r_##__n = vxd_##__n - vkd_##__n
+
+__AARCH64_VECTOR_PCS_ATTR static __Float32x4_t
+__scalar_powf(__Float32x4_t x, __Float32x4_t y, __Float32x4_t r,
+	      __Uint32x4_t special)
+{
+  return fixup2_v4sf (powf, x, y, r, special);
+}
+
+static __always_inline __Float32x4_t
+__powf_v4sf(__Float32x4_t x, __Float32x4_t y)
+{
+  __Float32x4_t ax, ys, yt, yh, one, z, k, result;
+  __Float64x2_t vz_0, vz_1, vinvc_0, vinvc_1, vlogc_0, vlogc_1, vk_0, vk_1;
+  __Float64x2_t va0, va1, va2, va3, va4, vone, vlimit, vc0, vc1, vc2;
+  __Float64x2_t r_0, r_1, r2_0, r2_1, r4_0, r4_1, p_0, p_1, q_0, q_1;
+  __Float64x2_t y_0, y_1, vxd_0, vxd_1, vkd_0, vkd_1, vs_0, vs_1, vshift;
+  __Uint64x2_t ki_0, ki_1;
+  __Uint32x4_t special, neg, yint, invalid, sign, sub, ix, tmp, top, i;
+
+  MVEC_STATS_VECTOR (POWF);
+
+  /* Lanes where x is zero, inf or nan or y is inf or nan are
+     recomputed by __scalar_powf.  They are replaced by 1^1 in the
+     vector evaluation.  Every other lane, including negative and
+     subnormal x and any finite y, is computed here.  */
+  one = (__Float32x4_t) { 1.0f, 1.0f, 1.0f, 1.0f };
+  ax = __builtin_aarch64_absv4sf (x);
+  special = (__Uint32x4_t) ~((ax > 0) & (ax <= FLT_MAX)
+			     & (__builtin_aarch64_absv4sf (y) <= FLT_MAX));
+  MVEC_STATS_LANES (POWF, SPECIAL, count_lanes_v4si (special));
+  ax = select_v4sf (special, one, ax);
+  ys = select_v4sf (special, one, y);
+
+  /* powf(x, y) = +-powf(|x|, y) for x < 0 and integer y, with the
+     sign of x when y is odd, and nan when y is not an integer.  Every
+     y with |y| >= 2^24 is an even integer.  */
+  neg = (__Uint32x4_t) (x < 0);
+  yt = __builtin_aarch64_btruncv4sf (ys);
+  yh = ys * 0.5f;
+  yint = (__Uint32x4_t) (yt == ys);
+  invalid = neg & ~yint;
+  sign = neg & yint & (__Uint32x4_t) (__builtin_aarch64_btruncv4sf (yh) != yh)
+	 & 0x80000000;
+
+  /* Normalize subnormal x, the exponent bias is taken off again in
+     its bits.  */
+  ix = (__Uint32x4_t) ax;
+  sub = (__Uint32x4_t) (ax < FLT_MIN);
+  if (__glibc_unlikely (any_lane_v4si (sub)))
+    ix = (__Uint32x4_t) select_v4sf (sub, ax * 0x1p23f, ax)
+	 - (sub & (23 << 23));
+
+  /* log2(x) scaled by POWF_SCALE, with a relative error below 2^-33.
+     x = 2^k z with z in [OFF, 2 OFF), the top bits of z - OFF select
+     the table entry, which TBL looks up without moving the indices
+     out of the vector registers.  z and k are exact in float and
+     widened to double.  */
+  tmp = ix - OFF;
+  top = tmp & 0xff800000;
+  z = (__Float32x4_t) (ix - top);
+  k = __builtin_aarch64_floatv4siv4sf ((__Int32x4_t) top
+				       >> (23 - POWF_SCALE_BITS));
+  i = (tmp >> (23 - POWF_LOG2_TABLE_BITS)) % N;
+  logf_lookup_v2df (&T, i, &vinvc_0, &vinvc_1, &vlogc_0, &vlogc_1);
+  vz_0 = get_lo_and_extend (z);
+  vz_1 = get_hi_and_extend (z);
+  vk_0 = get_lo_and_extend (k);
+  vk_1 = get_hi_and_extend (k);
+  vone = (__Float64x2_t) { 1.0, 1.0 };
+  va0 = A[0];
+  va1 = A[1];
+  va2 = A[2];
+  va3 = A[3];
+  va4 = A[4];
+
+  /* log2(x) = log1p(z/c-1)/ln2 + log2(c) + k */
+  r_0 = vz_0 * vinvc_0 - vone;
+  r_1 = vz_1 * vinvc_1 - vone;
+  q_0 = vlogc_0 + vk_0;
+  q_1 = vlogc_1 + vk_1;
+
+  /* Pipelined polynomial evaluation to approximate log1p(r)/ln2.  */
+  r2_0 = r_0 * r_0;
+  r2_1 = r_1 * r_1;
+  y_0 = va0 * r_0 + va1;
+  y_1 = va0 * r_1 + va1;
+  p_0 = va2 * r_0 + va3;
+  p_1 = va2 * r_1 + va3;
+  r4_0 = r2_0 * r2_0;
+  r4_1 = r2_1 * r2_1;
+  q_0 = va4 * r_0 + q_0;
+  q_1 = va4 * r_1 + q_1;
+  q_0 = p_0 * r2_0 + q_0;
+  q_1 = p_1 * r2_1 + q_1;
+  y_0 = y_0 * r4_0 + q_0;
+  y_1 = y_1 * r4_1 + q_1;
+
+  /* y*log2(x) cannot overflow in double since y is a float.  */
+  vlimit = (__Float64x2_t) { LIMIT, LIMIT };
+  vxd_0 = get_lo_and_extend (ys) * y_0 * (1.0 / POWF_SCALE);
+  vxd_1 = get_hi_and_extend (ys) * y_1 * (1.0 / POWF_SCALE);
+  vxd_0 = __builtin_aarch64_smin_nanv2df (vxd_0, vlimit);
+  vxd_1 = __builtin_aarch64_smin_nanv2df (vxd_1, vlimit);
+  vxd_0 = __builtin_aarch64_smax_nanv2df (vxd_0, -vlimit);
+  vxd_1 = __builtin_aarch64_smax_nanv2df (vxd_1, -vlimit);
+
+  vshift = SHIFT;
+  CALC_EXP2(0);
+  CALC_EXP2(1);
+  exp2f_scale_v2df (ki_0, ki_1, &vs_0, &vs_1);
+  vc0 = C[0];
+  vc1 = C[1];
+  vc2 = C[2];
+
+  /* exp2(x) = 2^(k/N) * 2^r ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
+  p_0 = vc0 * r_0 + vc1;
+  p_1 = vc0 * r_1 + vc1;
+  r2_0 = r_0 * r_0;
+  r2_1 = r_1 * r_1;
+  y_0 = vc2 * r_0 + vone;
+  y_1 = vc2 * r_1 + vone;
+  y_0 = p_0 * r2_0 + y_0;
+  y_1 = p_1 * r2_1 + y_1;
+  y_0 = y_0 * vs_0;
+  y_1 = y_1 * vs_1;
+  result = pack_and_trunc (y_0, y_1);
+  result = (__Float32x4_t) ((__Uint32x4_t) result | sign);
+
+  if (__glibc_unlikely (any_lane_v4si (invalid)))
+    result = select_v4sf (invalid,
+			  (__Float32x4_t) { NAN, NAN, NAN, NAN }, result);
+  if (__glibc_unlikely (any_lane_v4si (special)))
+    return __scalar_powf (x, y, result, special);
+  return result;
+}
+
+#undef N
+#undef T
+#undef A
+#undef OFF
+#undef C
+#undef SHIFT
+#undef LIMIT
+#undef CALC_EXP2
+
+#endif
@@ -0,0 +1,103 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libmvec_float_vlen4_sincosf.h"
+
+LIBMVEC_ENTRY (__Float32x4_t, _ZGVnN4v_sinf, (__Float32x4_t x), (x),
+	       __sinf_v4sf)
+weak_alias (_ZGVnN4v_sinf, _ZGVnN4v___sinf_finite)
+
+/* Inactive lanes are fed 1.0, which takes no special path.  */
+__AARCH64_VECTOR_PCS_ATTR __Float32x4_t
+_ZGVnM4v_sinf(__Float32x4_t x, __Uint32x4_t mask)
+{
+  return _ZGVnN4v_sinf (mask_v4sf (mask, x, 1.0f));
+}
+weak_alias (_ZGVnM4v_sinf, _ZGVnM4v___sinf_finite)
+
+LIBMVEC_ENTRY (__Float32x4_t, _ZGVnN4v_cosf, (__Float32x4_t x), (x),
+	       __cosf_v4sf)
+weak_alias (_ZGVnN4v_cosf, _ZGVnN4v___cosf_finite)
+
+/* Inactive lanes are fed 1.0, which takes no special path.  */
+__AARCH64_VECTOR_PCS_ATTR __Float32x4_t
+_ZGVnM4v_cosf(__Float32x4_t x, __Uint32x4_t mask)
+{
+  return _ZGVnN4v_cosf (mask_v4sf (mask, x, 1.0f));
+}
+weak_alias (_ZGVnM4v_cosf, _ZGVnM4v___cosf_finite)
+
+LIBMVEC_ENTRY_VOID (_ZGVnN4vl4l4_sincosf,
+		    (__Float32x4_t x, float *sinp, float *cosp),
+		    (x, sinp, cosp), __sincosf_l4l4)
+weak_alias (_ZGVnN4vl4l4_sincosf, _ZGVnN4vl4l4___sincosf_finite)
+
+LIBMVEC_ENTRY_VOID (_ZGVnN4vvv_sincosf,
+		    (__Float32x4_t x, __Uint64x2_t sinp_0,
+		     __Uint64x2_t sinp_1, __Uint64x2_t cosp_0,
+		     __Uint64x2_t cosp_1),
+		    (x, sinp_0, sinp_1, cosp_0, cosp_1), __sincosf_vvv)
+weak_alias (_ZGVnN4vvv_sincosf, _ZGVnN4vvv___sincosf_finite)
+
+/* Destination pointers of lanes I and I + 1 for the masked sincosf:
+   P where MASK is set, SCRATCH elsewhere, so that inactive lanes store
+   nothing the caller can see.  */
+static __always_inline __Uint64x2_t
+__sincosf_dest(__Uint64x2_t p, __Uint32x4_t mask, int i, float *scratch)
+{
+  __Uint64x2_t m = { mask[i] != 0 ? -1 : 0, mask[i + 1] != 0 ? -1 : 0 };
+
+  return (m & p) | (~m & (uint64_t) scratch);
+}
+
+/* Inactive lanes are fed 1.0, which takes no special path, and
+   write to a local scratch slot instead of SINP[i] and COSP[i].  */
+__AARCH64_VECTOR_PCS_ATTR void
+_ZGVnM4vl4l4_sincosf(__Float32x4_t x, float *sinp, float *cosp,
+		     __Uint32x4_t mask)
+{
+  float scratch;
+  __Uint64x2_t sp_0 = { (uint64_t) sinp, (uint64_t) (sinp + 1) };
+  __Uint64x2_t sp_1 = { (uint64_t) (sinp + 2), (uint64_t) (sinp + 3) };
+  __Uint64x2_t cp_0 = { (uint64_t) cosp, (uint64_t) (cosp + 1) };
+  __Uint64x2_t cp_1 = { (uint64_t) (cosp + 2), (uint64_t) (cosp + 3) };
+
+  _ZGVnN4vvv_sincosf (mask_v4sf (mask, x, 1.0f),
+		      __sincosf_dest (sp_0, mask, 0, &scratch),
+		      __sincosf_dest (sp_1, mask, 2, &scratch),
+		      __sincosf_dest (cp_0, mask, 0, &scratch),
+		      __sincosf_dest (cp_1, mask, 2, &scratch));
+}
+weak_alias (_ZGVnM4vl4l4_sincosf, _ZGVnM4vl4l4___sincosf_finite)
+
+__AARCH64_VECTOR_PCS_ATTR void
+_ZGVnM4vvv_sincosf(__Float32x4_t x, __Uint64x2_t sinp_0,
+		   __Uint64x2_t sinp_1, __Uint64x2_t cosp_0,
+		   __Uint64x2_t cosp_1, __Uint32x4_t mask)
+{
+  float scratch;
+
+  _ZGVnN4vvv_sincosf (mask_v4sf (mask, x, 1.0f),
+		      __sincosf_dest (sinp_0, mask, 0, &scratch),
+		      __sincosf_dest (sinp_1, mask, 2, &scratch),
+		      __sincosf_dest (cosp_0, mask, 0, &scratch),
+		      __sincosf_dest (cosp_1, mask, 2, &scratch));
+}
+weak_alias (_ZGVnM4vvv_sincosf, _ZGVnM4vvv___sincosf_finite)
+
+LIBMVEC_ARRAY_V4SF (mvec_sinf, __sinf_v4sf)
+LIBMVEC_ARRAY_V4SF (mvec_cosf, __cosf_v4sf)
+LIBMVEC_ARRAY_SINCOS_V4SF (mvec_sincosf, __sincosf_v4sf)
@@ -0,0 +1,301 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _LIBMVEC_FLOAT_VLEN4_SINCOSF_H
+#define _LIBMVEC_FLOAT_VLEN4_SINCOSF_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "endian.h"
+#include "libmvec_double_sinetable.h"
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+#include "libmvec_double_sinekernel.h"
+
+/* The float kernels reduce with n*pi or n*pi/2 split into three
+   floats, which is accurate for |x| < RANGE.  Larger and nonfinite
+   lanes go through the double reduction of libmvec_double_sinekernel.h.  */
+#define RANGE 0x1p20f
+
+/* Adding and subtracting SHIFT rounds to an integer, whose low bits
+   are then the low mantissa bits.  */
+#define SHIFT 0x1.8p23f
+
+#define InvPi 0x1.45f306p-2f
+#define Pi1 0x1.921fb6p+1f
+#define Pi2 -0x1.777a5cp-24f
+#define Pi3 -0x1.ee59dap-49f
+#define TwoOverPi 0x1.45f306p-1f
+
+/* sin(r) ~= r + r^3 * P(r^2) for |r| <= pi/2.  */
+#define P0 -0x1.555548p-3f
+#define P1 0x1.110df4p-7f
+#define P2 -0x1.9f42eap-13f
+#define P3 0x1.5b2e76p-19f
+
+/* sin(r) ~= r + r^3 * S(r^2) and cos(r) ~= 1 + r^2 * C(r^2) for
+   |r| <= pi/4.  */
+#define S0 -0x1.555552p-3f
+#define S1 0x1.110c26p-7f
+#define S2 -0x1.9ac856p-13f
+#define C0 -0x1p-1f
+#define C1 0x1.55554cp-5f
+#define C2 -0x1.6c0e04p-10f
+#define C3 0x1.9a6dbap-16f
+
+static __always_inline __Float32x4_t
+__sinf_dup(float c)
+{
+  return (__Float32x4_t) { c, c, c, c };
+}
+
+/* sin and cos of all lanes of X computed in double, for the lanes with
+   |x| >= RANGE.  inf and nan lanes give nan.  */
+static void
+__sincosf_large(__Float32x4_t x, __Float32x4_t *sinp, __Float32x4_t *cosp)
+{
+  __Float64x2_t xd[2], s[2], c[2], a, xs, x0, r1, k;
+  __Uint64x2_t special;
+  unsigned int tablebase_0, tablebase_1, sinbase_0, sinbase_1;
+  int i;
+
+  xd[0] = get_lo_and_extend (x);
+  xd[1] = get_hi_and_extend (x);
+  for (i = 0; i < 2; i++)
+    {
+      a = __builtin_aarch64_absv2df (xd[i]);
+      special = (__Uint64x2_t) ~(a < INFINITY);
+      xs = select_v2df (special, (__Float64x2_t) { 0.0, 0.0 }, a);
+
+      k = _sine_reduce (xs, &x0, &r1);
+      tablebase_0 = (unsigned int) k[0];
+      tablebase_1 = (unsigned int) k[1];
+      sinbase_0 = tablebase_0;
+      sinbase_1 = tablebase_1;
+      if (!(xd[i][0] > 0))
+	sinbase_0 += 1<<4;
+      if (!(xd[i][1] > 0))
+	sinbase_1 += 1<<4;
+
+      s[i] = _sine_eval (x0, r1, (double *)_sin_table,
+			 (sinbase_0 << 2) & 0x7c, (sinbase_1 << 2) & 0x7c);
+      c[i] = _sine_eval (x0, r1, (double *)_cos_table,
+			 (tablebase_0 << 2) & 0x7c, (tablebase_1 << 2) & 0x7c);
+      s[i] = select_v2df (special, xd[i] - xd[i], s[i]);
+      c[i] = select_v2df (special, xd[i] - xd[i], c[i]);
+    }
+  *sinp = pack_and_trunc (s[0], s[1]);
+  *cosp = pack_and_trunc (c[0], c[1]);
+}
+
+/* sin(r) for |r| <= pi/2.  */
+static __always_inline __Float32x4_t
+__sinf_poly(__Float32x4_t r)
+{
+  __Float32x4_t r2, y;
+
+  r2 = r * r;
+  y = __builtin_aarch64_fmav4sf (__sinf_dup (P3), r2, __sinf_dup (P2));
+  y = __builtin_aarch64_fmav4sf (y, r2, __sinf_dup (P1));
+  y = __builtin_aarch64_fmav4sf (y, r2, __sinf_dup (P0));
+  return __builtin_aarch64_fmav4sf (y * r2, r, r);
+}
+
+//
+// sine entry point
+//
+
+/* sin(x) = sign(x) (-1)^n sin(r) with r = |x| - n*pi in [-pi/2, pi/2].
+   Reducing |x| keeps the sign of sin(-0).  */
+static __always_inline __Float32x4_t
+__sinf_v4sf(__Float32x4_t x)
+{
+  __Float32x4_t a, n, r, y, s, c;
+  __Uint32x4_t odd, sign, large;
+
+  MVEC_STATS_VECTOR (SINF);
+
+  a = __builtin_aarch64_absv4sf (x);
+  sign = (__Uint32x4_t) x & 0x80000000;
+  large = (__Uint32x4_t) ~(a < RANGE);
+  MVEC_STATS_LANES (SINF, SPECIAL,
+		    count_lanes_v4si ((__Uint32x4_t) ~(a < INFINITY)));
+  MVEC_STATS_LANES (SINF, RANGE,
+		    count_lanes_v4si (large & (__Uint32x4_t) (a < INFINITY)));
+
+  n = __builtin_aarch64_fmav4sf (a, __sinf_dup (InvPi), __sinf_dup (SHIFT));
+  odd = (__Uint32x4_t) n << 31;
+  n = n - SHIFT;
+  r = __builtin_aarch64_fmav4sf (-n, __sinf_dup (Pi1), a);
+  r = __builtin_aarch64_fmav4sf (-n, __sinf_dup (Pi2), r);
+  r = __builtin_aarch64_fmav4sf (-n, __sinf_dup (Pi3), r);
+
+  y = __sinf_poly (r);
+  y = (__Float32x4_t) ((__Uint32x4_t) y ^ odd ^ sign);
+  if (__glibc_unlikely (any_lane_v4si (large)))
+    {
+      __sincosf_large (x, &s, &c);
+      y = select_v4sf (large, s, y);
+    }
+  return y;
+}
+
+//
+// cosine entry point
+//
+
+/* cos(x) = (-1)^n sin(r) with n = rint(|x|/pi + 1/2) and
+   r = |x| - (n - 1/2)*pi in [-pi/2, pi/2].  */
+static __always_inline __Float32x4_t
+__cosf_v4sf(__Float32x4_t x)
+{
+  __Float32x4_t a, n, r, y, s, c;
+  __Uint32x4_t odd, large;
+
+  MVEC_STATS_VECTOR (COSF);
+
+  a = __builtin_aarch64_absv4sf (x);
+  large = (__Uint32x4_t) ~(a < RANGE);
+  MVEC_STATS_LANES (COSF, SPECIAL,
+		    count_lanes_v4si ((__Uint32x4_t) ~(a < INFINITY)));
+  MVEC_STATS_LANES (COSF, RANGE,
+		    count_lanes_v4si (large & (__Uint32x4_t) (a < INFINITY)));
+
+  /* SHIFT + 0.5 is not a float, add the two separately.  */
+  n = __builtin_aarch64_fmav4sf (a, __sinf_dup (InvPi), __sinf_dup (0.5f));
+  n = n + SHIFT;
+  odd = (__Uint32x4_t) n << 31;
+  n = n - SHIFT - 0.5f;
+  r = __builtin_aarch64_fmav4sf (-n, __sinf_dup (Pi1), a);
+  r = __builtin_aarch64_fmav4sf (-n, __sinf_dup (Pi2), r);
+  r = __builtin_aarch64_fmav4sf (-n, __sinf_dup (Pi3), r);
+
+  y = __sinf_poly (r);
+  y = (__Float32x4_t) ((__Uint32x4_t) y ^ odd);
+  if (__glibc_unlikely (any_lane_v4si (large)))
+    {
+      __sincosf_large (x, &s, &c);
+      y = select_v4sf (large, c, y);
+    }
+  return y;
+}
+
+//
+// sincos entry point
+//
+
+/* One reduction r = |x| - q*pi/2 in [-pi/4, pi/4] feeds both results:
+   the low two bits of q pick sin(r) or cos(r) and the sign for each
+   of them, and sin also takes the sign of x.  */
+static __always_inline
+void __sincosf_v4sf(__Float32x4_t x, __Float32x4_t *sinp, __Float32x4_t *cosp)
+{
+  __Float32x4_t a, n, r, r2, ps, pc, s, c, ls, lc;
+  __Uint32x4_t q, swap, sign, large;
+
+  MVEC_STATS_VECTOR (SINCOSF);
+
+  a = __builtin_aarch64_absv4sf (x);
+  sign = (__Uint32x4_t) x & 0x80000000;
+  large = (__Uint32x4_t) ~(a < RANGE);
+  MVEC_STATS_LANES (SINCOSF, SPECIAL,
+		    count_lanes_v4si ((__Uint32x4_t) ~(a < INFINITY)));
+  MVEC_STATS_LANES (SINCOSF, RANGE,
+		    count_lanes_v4si (large & (__Uint32x4_t) (a < INFINITY)));
+
+  n = __builtin_aarch64_fmav4sf (a, __sinf_dup (TwoOverPi),
+				 __sinf_dup (SHIFT));
+  q = (__Uint32x4_t) n;
+  n = n - SHIFT;
+  r = __builtin_aarch64_fmav4sf (-n, __sinf_dup (0.5f * Pi1), a);
+  r = __builtin_aarch64_fmav4sf (-n, __sinf_dup (0.5f * Pi2), r);
+  r = __builtin_aarch64_fmav4sf (-n, __sinf_dup (0.5f * Pi3), r);
+
+  r2 = r * r;
+  ps = __builtin_aarch64_fmav4sf (__sinf_dup (S2), r2, __sinf_dup (S1));
+  ps = __builtin_aarch64_fmav4sf (ps, r2, __sinf_dup (S0));
+  ps = __builtin_aarch64_fmav4sf (ps * r2, r, r);
+  pc = __builtin_aarch64_fmav4sf (__sinf_dup (C3), r2, __sinf_dup (C2));
+  pc = __builtin_aarch64_fmav4sf (pc, r2, __sinf_dup (C1));
+  pc = __builtin_aarch64_fmav4sf (pc, r2, __sinf_dup (C0));
+  pc = __builtin_aarch64_fmav4sf (pc, r2, __sinf_dup (1.0f));
+
+  swap = (__Uint32x4_t) ((q & 1) != 0);
+  s = select_v4sf (swap, pc, ps);
+  c = select_v4sf (swap, ps, pc);
+  s = (__Float32x4_t) ((__Uint32x4_t) s ^ ((q & 2) << 30) ^ sign);
+  c = (__Float32x4_t) ((__Uint32x4_t) c ^ (((q + 1) & 2) << 30));
+  if (__glibc_unlikely (any_lane_v4si (large)))
+    {
+      __sincosf_large (x, &ls, &lc);
+      s = select_v4sf (large, ls, s);
+      c = select_v4sf (large, lc, c);
+    }
+  *sinp = s;
+  *cosp = c;
+}
+
+static __always_inline
+void __sincosf_l4l4(__Float32x4_t x, float *sinp, float *cosp)
+{
+__Float32x4_t s, c;
+
+  __sincosf_v4sf(x, &s, &c);
+  __builtin_memcpy (sinp, &s, sizeof (s));
+  __builtin_memcpy (cosp, &c, sizeof (c));
+}
+
+/* As above with vectors of destination pointers, two per result for
+   the four lanes.  */
+static __always_inline
+void __sincosf_vvv(__Float32x4_t x, __Uint64x2_t sinp_0,
+		   __Uint64x2_t sinp_1, __Uint64x2_t cosp_0,
+		   __Uint64x2_t cosp_1)
+{
+__Float32x4_t s, c;
+
+  __sincosf_v4sf(x, &s, &c);
+  *(float *) sinp_0[0] = s[0];
+  *(float *) sinp_0[1] = s[1];
+  *(float *) sinp_1[0] = s[2];
+  *(float *) sinp_1[1] = s[3];
+  *(float *) cosp_0[0] = c[0];
+  *(float *) cosp_0[1] = c[1];
+  *(float *) cosp_1[0] = c[2];
+  *(float *) cosp_1[1] = c[3];
+}
+
+#undef RANGE
+#undef SHIFT
+#undef InvPi
+#undef Pi1
+#undef Pi2
+#undef Pi3
+#undef TwoOverPi
+#undef P0
+#undef P1
+#undef P2
+#undef P3
+#undef S0
+#undef S1
+#undef S2
+#undef C0
+#undef C1
+#undef C2
+#undef C3
+
+#endif
@@ -0,0 +1,54 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "libmvec_float_vlen4_sinhcoshf.h"
+
+LIBMVEC_ENTRY (__Float32x4_t, _ZGVnN4v_sinhf, (__Float32x4_t x), (x),
+	       __sinhf_v4sf)
+weak_alias (_ZGVnN4v_sinhf, _ZGVnN4v___sinhf_finite)
+
+__AARCH64_VECTOR_PCS_ATTR __Float32x4_t
+_ZGVnM4v_sinhf(__Float32x4_t x, __Uint32x4_t mask)
+{
+  return _ZGVnN4v_sinhf (mask_v4sf (mask, x, 0.0f));
+}
+weak_alias (_ZGVnM4v_sinhf, _ZGVnM4v___sinhf_finite)
+
+LIBMVEC_ENTRY (__Float32x4_t, _ZGVnN4v_coshf, (__Float32x4_t x), (x),
+	       __coshf_v4sf)
+weak_alias (_ZGVnN4v_coshf, _ZGVnN4v___coshf_finite)
+
+__AARCH64_VECTOR_PCS_ATTR __Float32x4_t
+_ZGVnM4v_coshf(__Float32x4_t x, __Uint32x4_t mask)
+{
+  return _ZGVnN4v_coshf (mask_v4sf (mask, x, 0.0f));
+}
+weak_alias (_ZGVnM4v_coshf, _ZGVnM4v___coshf_finite)
+
+LIBMVEC_ENTRY (__Float32x4_t, _ZGVnN4v_tanhf, (__Float32x4_t x), (x),
+	       __tanhf_v4sf)
+weak_alias (_ZGVnN4v_tanhf, _ZGVnN4v___tanhf_finite)
+
+__AARCH64_VECTOR_PCS_ATTR __Float32x4_t
+_ZGVnM4v_tanhf(__Float32x4_t x, __Uint32x4_t mask)
+{
+  return _ZGVnN4v_tanhf (mask_v4sf (mask, x, 0.0f));
+}
+weak_alias (_ZGVnM4v_tanhf, _ZGVnM4v___tanhf_finite)
+
+LIBMVEC_ARRAY_V4SF (mvec_sinhf, __sinhf_v4sf)
+LIBMVEC_ARRAY_V4SF (mvec_coshf, __coshf_v4sf)
+LIBMVEC_ARRAY_V4SF (mvec_tanhf, __tanhf_v4sf)
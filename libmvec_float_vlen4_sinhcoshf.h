@@ -0,0 +1,209 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Based on expf.c from https://github.com/ARM-software/optimized-routines */
+
+#ifndef _LIBMVEC_FLOAT_VLEN4_SINHCOSHF_H
+#define _LIBMVEC_FLOAT_VLEN4_SINHCOSHF_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <sysdeps/ieee754/flt-32/math_config.h>
+#include "libmvec_util.h"
+#include "libmvec_float_data.h"
+
+#define N (1 << EXP2F_TABLE_BITS)
+/* sinhf(x) and coshf(x) overflow for |x| > 0x1.65a9fap6 and tanhf(x)
+   rounds to +-1 for |x| > 0x1.205966p3.  Clamping |x| to LIMIT and
+   TANH_LIMIT keeps every result, and exp of the clamped values is
+   computed in double without overflow, so the conversion to float
+   produces the inf results.  */
+#define LIMIT 100.0
+#define TANH_LIMIT 10.0
+
+/* Lanes with |x| < SMALL use Taylor series, where exp(x) - exp(-x)
+   would cancel.  */
+#define SMALL 0x1p-4
+
+#define InvLn2N __exp2f_v2df_data.invln2_scaled
+#define T __exp2f_data.tab
+#define C __exp2f_v2df_data.poly_scaled
+#define SHIFT __exp2f_v2df_data.shift
+
+/* exp(X) for 0 <= X <= 2 * TANH_LIMIT or LIMIT on two lanes widened
+   to double, with the table reduction of expf.  */
+static __always_inline __Float64x2_t
+__sinhf_exp(__Float64x2_t x)
+{
+  __Float64x2_t vInvLn2N, z, vkd, r, r2, vs, c0, c1, c2, y, one, shift;
+  __Uint64x2_t ki, t;
+
+  vInvLn2N = InvLn2N;
+  /* x*N/Ln2 = k + r with r in [-1/2, 1/2] and int k.  Adding SHIFT
+     leaves k in the low bits of ki, so only the table indices leave
+     the vector registers.  */
+  z = vInvLn2N * x;
+  shift = SHIFT;
+  vkd = z + shift;
+  ki = (__Uint64x2_t) vkd;
+  vkd -= shift;
+  r = z - vkd;
+
+  /* exp(x) = 2^(k/N) * 2^(r/N) ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
+  t = (__Uint64x2_t) { T[ki[0] % N], T[ki[1] % N] };
+  vs = (__Float64x2_t) (t + (ki << (52 - EXP2F_TABLE_BITS)));
+
+  c0 = C[0];
+  c1 = C[1];
+  c2 = C[2];
+  one = (__Float64x2_t) { 1.0, 1.0 };
+  z = c0 * r + c1;
+  r2 = r * r;
+  y = c2 * r + one;
+  y = z * r2 + y;
+  return y * vs;
+}
+
+/* Set the sign of the nonnegative R to the sign of X.  */
+static __always_inline __Float64x2_t
+__sinhf_copysign(__Float64x2_t r, __Float64x2_t x)
+{
+  __Uint64x2_t sign = (__Uint64x2_t) x & 0x8000000000000000;
+
+  return (__Float64x2_t) ((__Uint64x2_t) r | sign);
+}
+
+//
+// hyperbolic sine entry point
+//
+
+static __always_inline __Float64x2_t
+__sinhf_half(__Float64x2_t x)
+{
+  __Float64x2_t a, e, y, a2, p;
+  __Uint64x2_t small;
+
+  /* The nan propagating min leaves nan lanes alone.  */
+  a = __builtin_aarch64_absv2df (x);
+  a = __builtin_aarch64_smin_nanv2df (a, (__Float64x2_t) { LIMIT, LIMIT });
+  e = __sinhf_exp (a);
+  y = 0.5 * (e - 1.0 / e);
+
+  small = (__Uint64x2_t) (a < SMALL);
+  if (any_lane_v2di (small))
+    {
+      /* The series is cut after x^7, the first omitted term is below
+	 2^-50 relative.  */
+      a2 = a * a;
+      p = 0x1.a01a01a01a01ap-13 * a2 + 0x1.1111111111111p-7;
+      p = p * a2 + 0x1.5555555555555p-3;
+      y = select_v2df (small, a + a * a2 * p, y);
+    }
+  return __sinhf_copysign (y, x);
+}
+
+static __always_inline __Float32x4_t
+__sinhf_v4sf(__Float32x4_t x)
+{
+  __Float64x2_t y_0, y_1;
+
+  MVEC_STATS_VECTOR (SINHF);
+
+  y_0 = __sinhf_half (get_lo_and_extend (x));
+  y_1 = __sinhf_half (get_hi_and_extend (x));
+  return pack_and_trunc (y_0, y_1);
+}
+
+//
+// hyperbolic cosine entry point
+//
+
+static __always_inline __Float64x2_t
+__coshf_half(__Float64x2_t x)
+{
+  __Float64x2_t a, e;
+
+  a = __builtin_aarch64_absv2df (x);
+  a = __builtin_aarch64_smin_nanv2df (a, (__Float64x2_t) { LIMIT, LIMIT });
+  e = __sinhf_exp (a);
+  return 0.5 * (e + 1.0 / e);
+}
+
+static __always_inline __Float32x4_t
+__coshf_v4sf(__Float32x4_t x)
+{
+  __Float64x2_t y_0, y_1;
+
+  MVEC_STATS_VECTOR (COSHF);
+
+  y_0 = __coshf_half (get_lo_and_extend (x));
+  y_1 = __coshf_half (get_hi_and_extend (x));
+  return pack_and_trunc (y_0, y_1);
+}
+
+//
+// hyperbolic tangent entry point
+//
+
+static __always_inline __Float64x2_t
+__tanhf_half(__Float64x2_t x)
+{
+  __Float64x2_t a, e, y, a2, p;
+  __Uint64x2_t small;
+
+  a = __builtin_aarch64_absv2df (x);
+  a = __builtin_aarch64_smin_nanv2df (a, (__Float64x2_t) { TANH_LIMIT,
+							   TANH_LIMIT });
+  e = __sinhf_exp (a + a);
+  y = (e - 1.0) / (e + 1.0);
+
+  small = (__Uint64x2_t) (a < SMALL);
+  if (any_lane_v2di (small))
+    {
+      /* The series is cut after x^9, the first omitted term is below
+	 2^-46 relative.  */
+      a2 = a * a;
+      p = 0x1.664f4882c10fap-6 * a2 - 0x1.ba1ba1ba1ba1cp-5;
+      p = p * a2 + 0x1.1111111111111p-3;
+      p = p * a2 - 0x1.5555555555555p-2;
+      y = select_v2df (small, a + a * a2 * p, y);
+    }
+  return __sinhf_copysign (y, x);
+}
+
+static __always_inline __Float32x4_t
+__tanhf_v4sf(__Float32x4_t x)
+{
+  __Float64x2_t y_0, y_1;
+
+  MVEC_STATS_VECTOR (TANHF);
+
+  y_0 = __tanhf_half (get_lo_and_extend (x));
+  y_1 = __tanhf_half (get_hi_and_extend (x));
+  return pack_and_trunc (y_0, y_1);
+}
+
+#undef N
+#undef LIMIT
+#undef TANH_LIMIT
+#undef SMALL
+#undef InvLn2N
+#undef T
+#undef C
+#undef SHIFT
+
+#endif
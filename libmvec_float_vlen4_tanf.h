@@ -0,0 +1,57 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _LIBMVEC_FLOAT_VLEN4_TANF_H
+#define _LIBMVEC_FLOAT_VLEN4_TANF_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include "endian.h"
+#include "libmvec_double_sinetable.h"
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+#include "libmvec_double_sinekernel.h"
+
+/* Each half is widened to double and run through the double tangent
+   kernel, whose error is far below the float precision of the
+   result.  Large arguments take the same Payne-Hanek reduction.  */
+static __always_inline __Float32x4_t
+__tanf_v4sf(__Float32x4_t x)
+{
+  __Float32x4_t result, xs;
+  __Float64x2_t y_0, y_1;
+  __Uint32x4_t special;
+
+  MVEC_STATS_VECTOR (TANF);
+
+  /* inf and nan lanes are fed to the kernel as zero and give nan.  */
+  special = (__Uint32x4_t) ~(__builtin_aarch64_absv4sf (x) < INFINITY);
+  MVEC_STATS_LANES (TANF, SPECIAL, count_lanes_v4si (special));
+  MVEC_STATS_LANES (TANF, RANGE,
+		    count_lanes_v4si (~special & (__Uint32x4_t)
+				      (__builtin_aarch64_absv4sf (x) > CUTOFF)));
+  xs = select_v4sf (special, (__Float32x4_t) { 0.0f, 0.0f, 0.0f, 0.0f }, x);
+
+  y_0 = _tan_kernel (get_lo_and_extend (xs));
+  y_1 = _tan_kernel (get_hi_and_extend (xs));
+  result = pack_and_trunc (y_0, y_1);
+  if (__glibc_unlikely (any_lane_v4si (special)))
+    result = select_v4sf (special, x - x, result);
+  return result;
+}
+
+#endif
@@ -0,0 +1,71 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Inlinable forms of the AdvSIMD kernels.  Each _ZGVnN* entry point
+   is a call into a kernel that is also usable directly: including
+   this header (or one libmvec_<type>_vlen<n>_<func>.h) gives the
+   static always-inline kernels
+
+     __<func>_v2df (__Float64x2_t x)
+     __<func>f_v4sf (__Float32x4_t x)
+
+   for the functions of libmvec_array.h, with two arguments for pow
+   and atan2 and with __sincos_v2df (x, &s, &c) and
+   __sincosf_v4sf (x, &s, &c).  With LIBMVEC_FLOAT32_KERNELS the
+   expf, exp2f, logf and log2f entry points use __<func>_f32_v4sf
+   instead.  Called from a loop, a kernel avoids the call and the
+   spills of v8-v15 required when the vector PCS is not available,
+   and the compiler can hoist its constants out of the loop.  The
+   entry points are built from the same headers, so both give the
+   same results.
+
+   The kernels read the hidden libmvec tables, so code using them has
+   to be linked with the libmvec objects rather than the shared
+   library.  */
+
+#ifndef _LIBMVEC_INLINE_H
+#define _LIBMVEC_INLINE_H
+
+#include "libmvec_double_vlen2_asin.h"
+#include "libmvec_double_vlen2_atan.h"
+#include "libmvec_double_vlen2_exp.h"
+#include "libmvec_double_vlen2_exp10.h"
+#include "libmvec_double_vlen2_exp2.h"
+#include "libmvec_double_vlen2_expm1.h"
+#include "libmvec_double_vlen2_log.h"
+#include "libmvec_double_vlen2_log10.h"
+#include "libmvec_double_vlen2_log1p.h"
+#include "libmvec_double_vlen2_log2.h"
+#include "libmvec_double_vlen2_pow.h"
+#include "libmvec_double_vlen2_sincos.h"
+#include "libmvec_double_vlen2_sinhcosh.h"
+#include "libmvec_double_vlen2_tan.h"
+#include "libmvec_float_vlen4_asinf.h"
+#include "libmvec_float_vlen4_atanf.h"
+#include "libmvec_float_vlen4_exp10f.h"
+#include "libmvec_float_vlen4_exp2f.h"
+#include "libmvec_float_vlen4_expf.h"
+#include "libmvec_float_vlen4_expm1f.h"
+#include "libmvec_float_vlen4_log10f.h"
+#include "libmvec_float_vlen4_log1pf.h"
+#include "libmvec_float_vlen4_log2f.h"
+#include "libmvec_float_vlen4_logf.h"
+#include "libmvec_float_vlen4_powf.h"
+#include "libmvec_float_vlen4_sincosf.h"
+#include "libmvec_float_vlen4_sinhcoshf.h"
+#include "libmvec_float_vlen4_tanf.h"
+
+#endif
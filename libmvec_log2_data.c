@@ -1 +1,16 @@
 #include <e_log2_data.c>
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+
+#define D __log2_data
+
+const struct log2_v2df_data __log2_v2df_data = {
+  .invln2hi = V2 (D.invln2hi),
+  .invln2lo = V2 (D.invln2lo),
+  .poly = { V2 (D.poly[0]), V2 (D.poly[1]), V2 (D.poly[2]),
+	    V2 (D.poly[3]), V2 (D.poly[4]), V2 (D.poly[5]) },
+  .poly1 = { V2 (D.poly1[0]), V2 (D.poly1[1]), V2 (D.poly1[2]),
+	     V2 (D.poly1[3]), V2 (D.poly1[4]), V2 (D.poly1[5]),
+	     V2 (D.poly1[6]), V2 (D.poly1[7]), V2 (D.poly1[8]),
+	     V2 (D.poly1[9]) },
+};
@@ -1 +1,16 @@
 #include <e_log_data.c>
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+
+#define D __log_data
+
+const struct log_v2df_data __log_v2df_data = {
+  .ln2hi = V2 (D.ln2hi),
+  .ln2lo = V2 (D.ln2lo),
+  .poly = { V2 (D.poly[0]), V2 (D.poly[1]), V2 (D.poly[2]),
+	    V2 (D.poly[3]), V2 (D.poly[4]) },
+  .poly1 = { V2 (D.poly1[0]), V2 (D.poly1[1]), V2 (D.poly1[2]),
+	     V2 (D.poly1[3]), V2 (D.poly1[4]), V2 (D.poly1[5]),
+	     V2 (D.poly1[6]), V2 (D.poly1[7]), V2 (D.poly1[8]),
+	     V2 (D.poly1[9]), V2 (D.poly1[10]) },
+};
@@ -0,0 +1,117 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* The coefficient blocks of the AdvSIMD kernels that are not derived
+   from a glibc table, replicated across a vector.  Defining them here,
+   away from the kernels, keeps their initializers out of sight of the
+   compiler where the kernels are built: it loads neighbouring vectors
+   of a block with one ldp instead of folding every element into a
+   literal pool entry of its own, and it still knows the blocks are
+   read only, so a loop that inlines a kernel loads them once.  */
+
+#include "math_config.h"
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+#include "libmvec_float_data.h"
+
+const struct sin_v2df_data __sin_v2df_data = {
+  .sin_poly = { V2 (-0x1.5555555555553p-3), V2 (0x1.1111111110118p-7),
+		V2 (-0x1.a01a0195a7da4p-13), V2 (0x1.71de08e8479a9p-19),
+		V2 (-0x1.ad8cad49bf21ap-26) },
+  .cos_poly = { V2 (-0x1.ffffffffffff1p-2), V2 (0x1.5555555552102p-5),
+		V2 (-0x1.6c16c15b069e2p-10), V2 (0x1.a019b110979b6p-16),
+		V2 (-0x1.2735878aa5acfp-22) },
+};
+
+const __Float64x2_t __asin_poly[13] = {
+  V2 (0x1.5555555555556p-3), V2 (0x1.3333333332ecap-4),
+  V2 (0x1.6db6db6e31f13p-5), V2 (0x1.f1c71c1db0623p-6),
+  V2 (0x1.6e8bb1c8209a2p-6), V2 (0x1.1c4d35cf95421p-6),
+  V2 (0x1.c9cf07674736ap-7), V2 (0x1.782651caa6547p-7),
+  V2 (0x1.52420b04b37bep-7), V2 (0x1.65a9c4dfcf8b2p-8),
+  V2 (0x1.1d189408314eep-6), V2 (-0x1.e6aaa8a0a04ccp-7),
+  V2 (0x1.d72b2bc8155f8p-6)
+};
+
+const __Float64x2_t __atan_poly[12] = {
+  V2 (-0x1.5555555555555p-2), V2 (0x1.99999999998c5p-3),
+  V2 (-0x1.24924924854fap-3), V2 (0x1.c71c71bd2b24cp-4),
+  V2 (-0x1.745d154c73072p-4), V2 (0x1.3b1375cc8b183p-4),
+  V2 (-0x1.110c9cca782dep-4), V2 (0x1.e1707db025c52p-5),
+  V2 (-0x1.ab59a4918c9bbp-5), V2 (0x1.700141f9da66fp-5),
+  V2 (-0x1.0f6229629ac10p-5), V2 (0x1.e4142f4ea3d2cp-7)
+};
+
+const __Float64x2_t __exp10_consts[4] = {
+  V2 (0x1.a934f0979a371p1 * (1 << EXP_TABLE_BITS)),
+  V2 (-0x1.3441350ap-2 / (1 << EXP_TABLE_BITS)),
+  V2 (0x1.0c0219dc1da99p-39 / (1 << EXP_TABLE_BITS)),
+  V2 (0x1.26bb1bbb55516p1)
+};
+
+const __Float64x2_t __log10_invln10[2] = {
+  V2 (0x1.bcb7b1526e50ep-2), V2 (0x1.95355baaafad3p-57)
+};
+
+#ifdef LIBMVEC_LOW_ACCURACY
+const __Float64x2_t __exp_poly_low[3] = {
+  V2 (0x1.0000000000722p-1), V2 (0x1.55555c9c02b17p-3),
+  V2 (0x1.55554800d37f7p-5)
+};
+
+const __Float64x2_t __exp2_poly_low[4] = {
+  V2 (0x1.62e42fefa3661p-1), V2 (0x1.ebfbdff82ca7fp-3),
+  V2 (0x1.c6b09b6008bbcp-5), V2 (0x1.3b2ab5b101ca5p-7)
+};
+
+const __Float64x2_t __log_poly_low[4] = {
+  V2 (-0x1.ffffffffbf316p-2), V2 (0x1.5555555506cefp-2),
+  V2 (-0x1.0000df1a00bdcp-2), V2 (0x1.999b501101269p-3)
+};
+
+const __Float64x2_t __log_near_one_poly_low[8] = {
+  V2 (0x1.555555554cc34p-2), V2 (-0x1.ffffffffe55c4p-3),
+  V2 (0x1.99999a3599653p-3), V2 (-0x1.55555617b48ecp-3),
+  V2 (0x1.249090efec62dp-3), V2 (-0x1.fffc45bed61a8p-4),
+  V2 (0x1.caedbe1f78a6dp-4), V2 (-0x1.9d5b7a52f47fap-4)
+};
+
+const __Float64x2_t __log2_poly_low[5] = {
+  V2 (-0x1.71547652b834dp-1), V2 (0x1.ec709dbcfcc2fp-2),
+  V2 (-0x1.715476443cf41p-2), V2 (0x1.277b9fa5f0284p-2),
+  V2 (-0x1.ec7c630988196p-3)
+};
+
+const __Float64x2_t __log2_near_one_poly_low[8] = {
+  V2 (-0x1.71547652b805bp-1), V2 (0x1.ec709dc39fa53p-2),
+  V2 (-0x1.7154765b7dd82p-2), V2 (0x1.2776c51a8d0e7p-2),
+  V2 (-0x1.ec701fdabb163p-3), V2 (0x1.a616d7be516e5p-3),
+  V2 (-0x1.72a2d927815dfp-3), V2 (0x1.49943a4a8a591p-3)
+};
+#endif
+
+const __Float64x2_t __asinf_poly[7] = {
+  V2 (0x1.5555555c0171dp-3), V2 (0x1.33331ecf8b70bp-4),
+  V2 (0x1.6dc0f007c13e8p-5), V2 (0x1.efedf83ab6506p-6),
+  V2 (0x1.82db23768c84fp-6), V2 (0x1.5a80a068e3ee2p-7),
+  V2 (0x1.fb7ca379d49c6p-6)
+};
+
+const __Float64x2_t __atanf_poly[6] = {
+  V2 (-0x1.555555443cb84p-2), V2 (0x1.9999673dff68bp-3),
+  V2 (-0x1.248626c4e2853p-3), V2 (0x1.c4f1e4544dc4ap-4),
+  V2 (-0x1.5d79a71158a86p-4), V2 (0x1.8b0a2809173b3p-5)
+};
@@ -0,0 +1,13 @@
+#include <e_pow_log_data.c>
+#include "libmvec_util.h"
+#include "libmvec_double_data.h"
+
+#define D __pow_log_data
+
+const struct pow_log_v2df_data __pow_log_v2df_data = {
+  .ln2hi = V2 (D.ln2hi),
+  .ln2lo = V2 (D.ln2lo),
+  .poly = { V2 (D.poly[0]), V2 (D.poly[1]), V2 (D.poly[2]),
+	    V2 (D.poly[3]), V2 (D.poly[4]), V2 (D.poly[5]),
+	    V2 (D.poly[6]) },
+};
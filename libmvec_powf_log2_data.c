@@ -0,0 +1,21 @@
+#include <math_config.h>
+#include <e_powf_log2_data.c>
+#include "libmvec_util.h"
+#include "libmvec_float_data.h"
+
+#define D __powf_log2_data
+
+const struct powf_log2_v2df_data __powf_log2_v2df_data = {
+  .poly = { V2 (D.poly[0]), V2 (D.poly[1]), V2 (D.poly[2]),
+	    V2 (D.poly[3]), V2 (D.poly[4]) },
+};
+
+/* The columns of D.tab, read from it so that they stay the same.  */
+#define INVC(i) D.tab[i].invc
+#define LOGC(i) D.tab[i].logc
+#define ROW(W, i) W (i), W (i + 1), W (i + 2), W (i + 3)
+
+const struct logf_tbl_data __powf_log2_tbl_data = {
+  .invc = { ROW (INVC, 0), ROW (INVC, 4), ROW (INVC, 8), ROW (INVC, 12) },
+  .logc = { ROW (LOGC, 0), ROW (LOGC, 4), ROW (LOGC, 8), ROW (LOGC, 12) },
+};
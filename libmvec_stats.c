@@ -0,0 +1,176 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "libmvec_util.h"
+
+static const char *const mvec_stats_func_names[MVEC_STATS_NFUNC] = {
+  [MVEC_STATS_EXP] = "exp",
+  [MVEC_STATS_EXP2] = "exp2",
+  [MVEC_STATS_EXP10] = "exp10",
+  [MVEC_STATS_EXPM1] = "expm1",
+  [MVEC_STATS_LOG] = "log",
+  [MVEC_STATS_LOG2] = "log2",
+  [MVEC_STATS_LOG10] = "log10",
+  [MVEC_STATS_LOG1P] = "log1p",
+  [MVEC_STATS_POW] = "pow",
+  [MVEC_STATS_SIN] = "sin",
+  [MVEC_STATS_COS] = "cos",
+  [MVEC_STATS_SINCOS] = "sincos",
+  [MVEC_STATS_TAN] = "tan",
+  [MVEC_STATS_ATAN] = "atan",
+  [MVEC_STATS_ATAN2] = "atan2",
+  [MVEC_STATS_ASIN] = "asin",
+  [MVEC_STATS_ACOS] = "acos",
+  [MVEC_STATS_SINH] = "sinh",
+  [MVEC_STATS_COSH] = "cosh",
+  [MVEC_STATS_TANH] = "tanh",
+  [MVEC_STATS_EXPF] = "expf",
+  [MVEC_STATS_EXP2F] = "exp2f",
+  [MVEC_STATS_EXP10F] = "exp10f",
+  [MVEC_STATS_EXPM1F] = "expm1f",
+  [MVEC_STATS_LOGF] = "logf",
+  [MVEC_STATS_LOG2F] = "log2f",
+  [MVEC_STATS_LOG10F] = "log10f",
+  [MVEC_STATS_LOG1PF] = "log1pf",
+  [MVEC_STATS_POWF] = "powf",
+  [MVEC_STATS_SINF] = "sinf",
+  [MVEC_STATS_COSF] = "cosf",
+  [MVEC_STATS_SINCOSF] = "sincosf",
+  [MVEC_STATS_TANF] = "tanf",
+  [MVEC_STATS_ATANF] = "atanf",
+  [MVEC_STATS_ATAN2F] = "atan2f",
+  [MVEC_STATS_ASINF] = "asinf",
+  [MVEC_STATS_ACOSF] = "acosf",
+  [MVEC_STATS_SINHF] = "sinhf",
+  [MVEC_STATS_COSHF] = "coshf",
+  [MVEC_STATS_TANHF] = "tanhf",
+};
+
+static const char *const mvec_stats_trigger_names[MVEC_STATS_NTRIGGER] = {
+  [MVEC_STATS_SPECIAL] = "special",
+  [MVEC_STATS_RANGE] = "range",
+  [MVEC_STATS_NEAR_ONE] = "near_one",
+};
+
+const char *
+mvec_stats_func_name (enum mvec_stats_func func)
+{
+  return (unsigned) func < MVEC_STATS_NFUNC
+	 ? mvec_stats_func_names[func] : NULL;
+}
+
+const char *
+mvec_stats_trigger_name (enum mvec_stats_trigger trigger)
+{
+  return (unsigned) trigger < MVEC_STATS_NTRIGGER
+	 ? mvec_stats_trigger_names[trigger] : NULL;
+}
+
+#ifdef LIBMVEC_STATS
+
+/* The counters of one thread.  Blocks are never freed, so the totals
+   keep the counts of threads that have exited.  */
+struct mvec_stats_thread
+{
+  struct mvec_stats stats[MVEC_STATS_NFUNC];
+  struct mvec_stats_thread *next;
+};
+
+static struct mvec_stats_thread *mvec_stats_threads;
+
+/* Shared by the threads whose block could not be allocated.  Their
+   concurrent updates may be lost, but they do not fail.  */
+static struct mvec_stats_thread mvec_stats_fallback;
+
+__thread struct mvec_stats *__mvec_stats_tls;
+
+struct mvec_stats *
+__mvec_stats_init (void)
+{
+  struct mvec_stats_thread *t;
+
+  t = calloc (1, sizeof (*t));
+  if (t == NULL)
+    return __mvec_stats_tls = mvec_stats_fallback.stats;
+  t->next = __atomic_load_n (&mvec_stats_threads, __ATOMIC_RELAXED);
+  while (!__atomic_compare_exchange_n (&mvec_stats_threads, &t->next, t, 1,
+				       __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+    ;
+  return __mvec_stats_tls = t->stats;
+}
+
+static void
+mvec_stats_add (struct mvec_stats *stats, const struct mvec_stats *t)
+{
+  int i, j;
+
+  for (i = 0; i < MVEC_STATS_NFUNC; i++)
+    {
+      stats[i].vectors += __atomic_load_n (&t[i].vectors, __ATOMIC_RELAXED);
+      for (j = 0; j < MVEC_STATS_NTRIGGER; j++)
+	stats[i].lanes[j] += __atomic_load_n (&t[i].lanes[j],
+					      __ATOMIC_RELAXED);
+    }
+}
+
+void
+mvec_stats_read (struct mvec_stats *stats)
+{
+  struct mvec_stats_thread *t;
+
+  memset (stats, 0, MVEC_STATS_NFUNC * sizeof (*stats));
+  for (t = __atomic_load_n (&mvec_stats_threads, __ATOMIC_ACQUIRE);
+       t != NULL; t = t->next)
+    mvec_stats_add (stats, t->stats);
+  mvec_stats_add (stats, mvec_stats_fallback.stats);
+}
+
+/* One line per function that was called: the vectors evaluated and
+   the lanes sent down each fallback path.  */
+static void __attribute__ ((destructor))
+mvec_stats_dump (void)
+{
+  struct mvec_stats stats[MVEC_STATS_NFUNC];
+  int i, j;
+
+  if (getenv ("LIBMVEC_STATS") == NULL)
+    return;
+  mvec_stats_read (stats);
+  for (i = 0; i < MVEC_STATS_NFUNC; i++)
+    {
+      if (stats[i].vectors == 0)
+	continue;
+      fprintf (stderr, "libmvec: %s vectors %llu", mvec_stats_func_names[i],
+	       (unsigned long long) stats[i].vectors);
+      for (j = 0; j < MVEC_STATS_NTRIGGER; j++)
+	fprintf (stderr, " %s %llu", mvec_stats_trigger_names[j],
+		 (unsigned long long) stats[i].lanes[j]);
+      fputc ('\n', stderr);
+    }
+}
+
+#else
+
+void
+mvec_stats_read (struct mvec_stats *stats)
+{
+  memset (stats, 0, MVEC_STATS_NFUNC * sizeof (*stats));
+}
+
+#endif
@@ -0,0 +1,102 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/* Fallback counters.  In a build with LIBMVEC_STATS every AdvSIMD
+   and SVE kernel counts the vectors it evaluates and, for each
+   trigger, the lanes that leave the main path.  An SVE call counts as
+   one vector whatever the vector length, its lanes are counted with
+   SVCNTP over the governing predicate.  The counters are kept per thread
+   so that counting never contends.  mvec_stats_read sums them over
+   all threads, including threads that have already exited, into
+   STATS[MVEC_STATS_NFUNC].  If LIBMVEC_STATS is set in the
+   environment, the totals are also printed to stderr at exit.
+   Without LIBMVEC_STATS, mvec_stats_read returns all zeros.  */
+
+#ifndef _LIBMVEC_STATS_H
+#define _LIBMVEC_STATS_H
+
+#include <stdint.h>
+
+enum mvec_stats_func
+{
+  MVEC_STATS_EXP,
+  MVEC_STATS_EXP2,
+  MVEC_STATS_EXP10,
+  MVEC_STATS_EXPM1,
+  MVEC_STATS_LOG,
+  MVEC_STATS_LOG2,
+  MVEC_STATS_LOG10,
+  MVEC_STATS_LOG1P,
+  MVEC_STATS_POW,
+  MVEC_STATS_SIN,
+  MVEC_STATS_COS,
+  MVEC_STATS_SINCOS,
+  MVEC_STATS_TAN,
+  MVEC_STATS_ATAN,
+  MVEC_STATS_ATAN2,
+  MVEC_STATS_ASIN,
+  MVEC_STATS_ACOS,
+  MVEC_STATS_SINH,
+  MVEC_STATS_COSH,
+  MVEC_STATS_TANH,
+  MVEC_STATS_EXPF,
+  MVEC_STATS_EXP2F,
+  MVEC_STATS_EXP10F,
+  MVEC_STATS_EXPM1F,
+  MVEC_STATS_LOGF,
+  MVEC_STATS_LOG2F,
+  MVEC_STATS_LOG10F,
+  MVEC_STATS_LOG1PF,
+  MVEC_STATS_POWF,
+  MVEC_STATS_SINF,
+  MVEC_STATS_COSF,
+  MVEC_STATS_SINCOSF,
+  MVEC_STATS_TANF,
+  MVEC_STATS_ATANF,
+  MVEC_STATS_ATAN2F,
+  MVEC_STATS_ASINF,
+  MVEC_STATS_ACOSF,
+  MVEC_STATS_SINHF,
+  MVEC_STATS_COSHF,
+  MVEC_STATS_TANHF,
+  MVEC_STATS_NFUNC
+};
+
+enum mvec_stats_trigger
+{
+  /* Zero, subnormal, negative, infinite or nan inputs where the
+     function needs them handled apart.  */
+  MVEC_STATS_SPECIAL,
+  /* Results that overflow or underflow, and arguments too large for
+     the fast reduction.  */
+  MVEC_STATS_RANGE,
+  /* Inputs close to 1 that take the separate log polynomial.  */
+  MVEC_STATS_NEAR_ONE,
+  MVEC_STATS_NTRIGGER
+};
+
+struct mvec_stats
+{
+  uint64_t vectors;
+  uint64_t lanes[MVEC_STATS_NTRIGGER];
+};
+
+extern void mvec_stats_read (struct mvec_stats *stats);
+extern const char *mvec_stats_func_name (enum mvec_stats_func func);
+extern const char *mvec_stats_trigger_name (enum mvec_stats_trigger trigger);
+
+#endif
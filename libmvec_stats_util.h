@@ -0,0 +1,82 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _LIBMVEC_STATS_UTIL_H
+#define _LIBMVEC_STATS_UTIL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "libmvec_stats.h"
+
+/* Fallback counters, see libmvec_stats.h.  MVEC_STATS_VECTOR (FUNC)
+   counts one vector evaluated by the kernel of FUNC and
+   MVEC_STATS_LANES (FUNC, TRIGGER, N) counts N lanes leaving its main
+   path, for example MVEC_STATS_LANES (EXP, RANGE, count_lanes_v2di (m))
+   or, in an SVE kernel, sve_count_lanes_f64 (pg, m).
+   Each nonzero count also fires the USDT probe libc:mvec_fallback
+   with the function, the trigger and N.  Without LIBMVEC_STATS both
+   expand to nothing and N is not evaluated.  */
+#ifdef LIBMVEC_STATS
+
+#include <stap-probe.h>
+
+extern __thread struct mvec_stats *__mvec_stats_tls attribute_hidden;
+extern struct mvec_stats *__mvec_stats_init (void) attribute_hidden;
+
+static __always_inline
+struct mvec_stats *mvec_stats_thread (enum mvec_stats_func func)
+{
+	struct mvec_stats *s = __mvec_stats_tls;
+
+	if (__glibc_unlikely (s == NULL))
+		s = __mvec_stats_init ();
+	return &s[func];
+}
+
+/* Only the owning thread writes its counters, so a plain increment
+   suffices.  The relaxed store keeps mvec_stats_read from seeing a
+   torn value.  */
+static __always_inline
+void mvec_stats_bump (uint64_t *p, uint64_t n)
+{
+	__atomic_store_n (p, *p + n, __ATOMIC_RELAXED);
+}
+
+#define MVEC_STATS_VECTOR(func)						\
+  mvec_stats_bump (&mvec_stats_thread (MVEC_STATS_##func)->vectors, 1)
+
+#define MVEC_STATS_LANES(func, trigger, n)				\
+  do									\
+    {									\
+      unsigned int __n = (n);						\
+      if (__n != 0)							\
+	{								\
+	  mvec_stats_bump (&mvec_stats_thread (MVEC_STATS_##func)	\
+			   ->lanes[MVEC_STATS_##trigger], __n);		\
+	  LIBC_PROBE (mvec_fallback, 3, MVEC_STATS_##func,		\
+		      MVEC_STATS_##trigger, __n);			\
+	}								\
+    }									\
+  while (0)
+
+#else
+
+#define MVEC_STATS_VECTOR(func) ((void) 0)
+#define MVEC_STATS_LANES(func, trigger, n) ((void) 0)
+
+#endif
+
+#endif
@@ -0,0 +1,124 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Helpers for the vector length agnostic _ZGVsMxv_* kernels.  Every
+   helper only touches the lanes active in PG.  */
+
+#include <stdint.h>
+#include <arm_sve.h>
+#include "libmvec_stats_util.h"
+
+/* Number of lanes active in PG with M set, for MVEC_STATS_LANES.  */
+static __always_inline
+unsigned int sve_count_lanes_f64 (svbool_t pg, svbool_t m)
+{
+	return svcntp_b64 (pg, m);
+}
+
+static __always_inline
+unsigned int sve_count_lanes_f32 (svbool_t pg, svbool_t m)
+{
+	return svcntp_b32 (pg, m);
+}
+
+/* The float kernels compute in double.  The even 32-bit lanes of a
+   float vector share their 64-bit container with the lane of the
+   same index in a double vector, the odd lanes are shifted down
+   first.  A predicate for the 32-bit lanes PG is also a valid
+   predicate for the even lanes, sve_odd_pg gives the one for the odd
+   lanes.  */
+static __always_inline
+svbool_t sve_odd_pg (svbool_t pg)
+{
+	return svtrn2_b32 (pg, pg);
+}
+
+static __always_inline
+svfloat64_t sve_even_f64 (svbool_t pg, svfloat32_t x)
+{
+	return svcvt_f64_f32_x (pg, x);
+}
+
+static __always_inline
+svfloat64_t sve_odd_f64 (svbool_t pg, svfloat32_t x)
+{
+	svuint64_t t = svlsr_n_u64_x (pg, svreinterpret_u64_f32 (x), 32);
+	return svcvt_f64_f32_x (pg, svreinterpret_f32_u64 (t));
+}
+
+static __always_inline
+svuint64_t sve_even_u64 (svbool_t pg, svuint32_t x)
+{
+	return svand_n_u64_x (pg, svreinterpret_u64_u32 (x), 0xffffffff);
+}
+
+static __always_inline
+svuint64_t sve_odd_u64 (svbool_t pg, svuint32_t x)
+{
+	return svlsr_n_u64_x (pg, svreinterpret_u64_u32 (x), 32);
+}
+
+static __always_inline
+svfloat64_t sve_even_f64_s32 (svbool_t pg, svint32_t x)
+{
+	return svcvt_f64_s32_x (pg, x);
+}
+
+static __always_inline
+svfloat64_t sve_odd_f64_s32 (svbool_t pg, svint32_t x)
+{
+	svint64_t t = svasr_n_s64_x (pg, svreinterpret_s64_s32 (x), 32);
+	return svcvt_f64_s64_x (pg, t);
+}
+
+/* Round the double results for the even and odd lanes to float and
+   interleave them back into one vector.  */
+static __always_inline
+svfloat32_t sve_pack_f32 (svbool_t pg, svbool_t pgo, svfloat64_t even,
+			  svfloat64_t odd)
+{
+	return svtrn1_f32 (svcvt_f32_f64_x (pg, even),
+			   svcvt_f32_f64_x (pgo, odd));
+}
+
+/* Predicated form of exp_specialcase_v2df from libmvec_util.h.  */
+static __always_inline
+svfloat64_t sve_exp_specialcase (svbool_t pg, svfloat64_t tmp,
+				 svuint64_t sbits, svbool_t pos)
+{
+	svfloat64_t scale, y, hi, lo;
+	svbool_t tiny;
+
+	sbits = svsel_u64 (pos, svsub_n_u64_x (pg, sbits, 1009ULL << 52),
+			   svadd_n_u64_x (pg, sbits, 1022ULL << 52));
+	scale = svreinterpret_f64_u64 (sbits);
+	y = svmla_f64_x (pg, scale, scale, tmp);
+
+	/* Round y to the right precision before scaling it into the
+	   subnormal range to avoid double rounding.  */
+	tiny = svbic_b_z (pg, svcmplt_n_f64 (pg, y, 1.0), pos);
+	lo = svmla_f64_x (pg, svsub_f64_x (pg, scale, y), scale, tmp);
+	hi = svadd_n_f64_x (pg, y, 1.0);
+	lo = svadd_f64_x (pg, svadd_f64_x (pg, svsubr_n_f64_x (pg, hi, 1.0), y),
+			  lo);
+	hi = svsub_n_f64_x (pg, svadd_f64_x (pg, hi, lo), 1.0);
+	/* Avoid -0.0 with downward rounding.  */
+	hi = svsel_f64 (svcmpeq_n_f64 (pg, hi, 0.0), svdup_n_f64 (0.0), hi);
+	y = svsel_f64 (tiny, hi, y);
+
+	return svmul_f64_x (pg, y, svsel_f64 (pos, svdup_n_f64 (0x1p1009),
+					      svdup_n_f64 (0x1p-1022)));
+}
@@ -14,7 +14,14 @@
  * limitations under the License.
  */
 
+#ifndef _LIBMVEC_UTIL_H
+#define _LIBMVEC_UTIL_H
+
+#include <stddef.h>
 #include <stdint.h>
+#include <arm_neon.h>
+#include "libmvec_array.h"
+#include "libmvec_stats_util.h"
 
 #ifdef COMPILER_SUPPORTS_SIMD_ABI
 #  define __AARCH64_VECTOR_PCS_ATTR __attribute__((aarch64_vector_pcs))
@@ -22,6 +29,49 @@
 #  define __AARCH64_VECTOR_PCS_ATTR
 #endif
 
+/* Accuracy tiers.  The default kernels are within these bounds, in
+   ulp, as checked by tests/libmvec_ulp.c (on all inputs for expf,
+   exp2f, logf and log2f, on random and boundary inputs otherwise):
+
+     exp, exp2, exp10, pow 0.52, expm1 0.6, log 0.53, log2 0.58,
+     log10 0.55, log1p 0.58, sin, cos 1.55, tan 3, atan 0.85,
+     atan2 1.5, asin, acos 0.7, sinh 2.2, cosh 1.05, tanh 2.4,
+     expf, exp2f, exp10f, tanf, atanf, atan2f, asinf, acosf,
+     coshf 0.51, expm1f, powf, sinhf, tanhf 0.52, logf 0.9,
+     log2f 0.76, log10f 1.0, log1pf 0.75, sinf, cosf 2,
+
+   and sincos and sincosf as sin and cos.  The bounds were measured on
+   a build that emulates the AdvSIMD builtins with fused multiply-add,
+   running tests/libmvec_ulp.c on AArch64 checks them on the target.
+
+   logf and log2f used to return the scalar result for the whole
+   vector when any lane was below 1.3, and log2 when either lane was
+   at most 1.32.  Those lanes now stay in vector code.  logf and log2f
+   compute the same table algorithm as the scalar functions and give
+   the same results, with worst cases of 0.82 ulp at 0x1.060106p+0 and
+   0.75 ulp at 0x1.0057f8p+0.  log2 uses a polynomial near 1.
+
+   Building with LIBMVEC_LOW_ACCURACY trades accuracy for speed with
+   shorter polynomials in exp, exp2, exp10, log and log2, and selects
+   the table-free float kernels, also with shorter polynomials, for
+   expf, exp2f, logf and log2f.  Bounds in that tier:
+
+     exp 2.1, exp2 1.3, exp10 2.1, log 2.8, log2 2.9 ulp,
+     expf 2.3, exp2f 2.2, logf 1.5, log2f 2.6 ulp,
+
+   with worst cases of EXPF, EXP2F, LOGF and LOG2F ulp for the float
+   functions over all inputs.
+
+   expm1, sinh and tanh keep the full polynomial: scale - 1 cancels
+   for small x and magnifies the error of the shorter one to 14-23
+   ulp.  cosh shares their reduction.  The other functions have a
+   single variant.  */
+#ifdef LIBMVEC_LOW_ACCURACY
+#  ifndef LIBMVEC_FLOAT32_KERNELS
+#    define LIBMVEC_FLOAT32_KERNELS
+#  endif
+#endif
+
 static __always_inline
 __Float64x2_t get_lo_and_extend (__Float32x4_t x)
 {
@@ -47,3 +97,586 @@ __Float32x4_t pack_and_trunc (__Float64x2_t x, __Float64x2_t y)
         __Float32x2_t yy = __builtin_aarch64_float_truncate_lo_v2sf (y);
         return (__builtin_aarch64_combinev2sf (xx, yy));
 }
+
+/* Return nonzero if any lane of the comparison mask M is set.  */
+static __always_inline
+int any_lane_v2di (__Uint64x2_t m)
+{
+	return (m[0] | m[1]) != 0;
+}
+
+static __always_inline
+int any_lane_v4si (__Uint32x4_t m)
+{
+	return __builtin_aarch64_reduc_umax_scal_v4si_uu (m) != 0;
+}
+
+/* Number of lanes set in the comparison mask M.  */
+static __always_inline
+unsigned int count_lanes_v2di (__Uint64x2_t m)
+{
+	return (m[0] != 0) + (m[1] != 0);
+}
+
+static __always_inline
+unsigned int count_lanes_v4si (__Uint32x4_t m)
+{
+	return -__builtin_aarch64_reduc_plus_scal_v4si ((__Int32x4_t) m);
+}
+
+/* Lanes of A where M is set, lanes of B elsewhere.  */
+static __always_inline
+__Float64x2_t select_v2df (__Uint64x2_t m, __Float64x2_t a, __Float64x2_t b)
+{
+	return (__Float64x2_t) ((m & (__Uint64x2_t) a) | (~m & (__Uint64x2_t) b));
+}
+
+static __always_inline
+__Float32x4_t select_v4sf (__Uint32x4_t m, __Float32x4_t a, __Float32x4_t b)
+{
+	return (__Float32x4_t) ((m & (__Uint32x4_t) a) | (~m & (__Uint32x4_t) b));
+}
+
+/* Lanes of X where the vector ABI mask MASK is set, BENIGN elsewhere.
+   The masked entry points use it so that inactive lanes never take a
+   special path; their results are unspecified.  */
+static __always_inline
+__Float64x2_t mask_v2df (__Uint64x2_t mask, __Float64x2_t x, double benign)
+{
+	return select_v2df ((__Uint64x2_t) (mask != 0), x,
+			    (__Float64x2_t) { benign, benign });
+}
+
+static __always_inline
+__Float32x4_t mask_v4sf (__Uint32x4_t mask, __Float32x4_t x, float benign)
+{
+	return select_v4sf ((__Uint32x4_t) (mask != 0), x,
+			    (__Float32x4_t) { benign, benign, benign, benign });
+}
+
+/* Initializers for constants stored replicated across all lanes.  */
+#define V2(x) { x, x }
+#define V4(x) { x, x, x, x }
+
+/* Two doubles at any 8 byte aligned address, for loading table
+   entries that sit next to each other with one 128-bit load.  */
+typedef double __libmvec_pair_t
+  __attribute__ ((__vector_size__ (16), __aligned__ (8), __may_alias__));
+
+/* The glibc tables keep the values looked up together side by side:
+   the tail and scale bits of exp, invc and logc of log, the hi and lo
+   parts of atan.  Load the pair at P0 for lane 0 and the pair at P1
+   for lane 1 and transpose them, leaving the first values of both
+   lanes in *A and the second in *B.  Two loads and two zips replace
+   four scalar loads and the moves that insert them into lanes.  */
+static __always_inline
+void lookup_pair_v2df (const void *p0, const void *p1,
+		       __Float64x2_t *a, __Float64x2_t *b)
+{
+	__Float64x2_t t0 = *(const __libmvec_pair_t *) p0;
+	__Float64x2_t t1 = *(const __libmvec_pair_t *) p1;
+
+	*a = __builtin_shuffle (t0, t1, (__Uint64x2_t) { 0, 2 });
+	*b = __builtin_shuffle (t0, t1, (__Uint64x2_t) { 1, 3 });
+}
+
+/* The entries of the 32 entry table TAB at the indices in I, which
+   must be below 32.  TBL fetches the bytes from the first 64 bytes of
+   the table and TBX those from the last 64 bytes, leaving the lanes
+   whose bytes the first lookup found alone, so four lanes are looked
+   up without moving the indices to general registers.  */
+static __always_inline
+__Uint32x4_t lookup32_v4si (const uint32_t *tab, __Uint32x4_t i)
+{
+	uint8x16x4_t t0 = vld1q_u8_x4 ((const uint8_t *) tab);
+	uint8x16x4_t t1 = vld1q_u8_x4 ((const uint8_t *) tab + 64);
+	/* Byte j of lane k indexes byte 4*i[k] + j of the table.  */
+	uint8x16_t b = (uint8x16_t) (i * 0x04040404 + 0x03020100);
+
+	return (__Uint32x4_t) vqtbx4q_u8 (vqtbl4q_u8 (t0, b), t1, b - 64);
+}
+
+/* The entries of the 16 entry table TAB at the indices in I, which
+   must be below 16, those of the first two lanes in *A and of the last
+   two in *B.  As in lookup32_v4si the 128 byte table is read with TBL
+   and TBX, here eight bytes per lane.  */
+static __always_inline
+void lookup16_v2df (const double *tab, __Uint32x4_t i,
+		    __Float64x2_t *a, __Float64x2_t *b)
+{
+	uint8x16x4_t t0 = vld1q_u8_x4 ((const uint8_t *) tab);
+	uint8x16x4_t t1 = vld1q_u8_x4 ((const uint8_t *) tab + 64);
+	/* Byte j of the double for lane k is byte 8*i[k] + j of the table.  */
+	__Uint32x4_t w = i * 0x08080808;
+	__Uint32x4_t o = { 0x03020100, 0x07060504, 0x03020100, 0x07060504 };
+	uint8x16_t b0, b1;
+
+	b0 = (uint8x16_t) (__builtin_shuffle (w, (__Uint32x4_t) { 0, 0, 1, 1 })
+			   + o);
+	b1 = (uint8x16_t) (__builtin_shuffle (w, (__Uint32x4_t) { 2, 2, 3, 3 })
+			   + o);
+
+	*a = (__Float64x2_t) vqtbx4q_u8 (vqtbl4q_u8 (t0, b0), t1, b0 - 64);
+	*b = (__Float64x2_t) vqtbx4q_u8 (vqtbl4q_u8 (t0, b1), t1, b1 - 64);
+}
+
+/* Vector form of specialcase from exp.c: compute SCALE * (1 + TMP)
+   where SCALE is the double with the bits SBITS, for lanes whose
+   exponent has overflowed (POS set) or underflowed (POS clear) by at
+   most 460.  Results in the subnormal range are rounded only once.  */
+static __always_inline
+__Float64x2_t exp_specialcase_v2df (__Float64x2_t tmp, __Uint64x2_t sbits,
+				    __Uint64x2_t pos)
+{
+	__Float64x2_t scale, y, hi, lo, one;
+	__Uint64x2_t tiny;
+
+	one = (__Float64x2_t) { 1.0, 1.0 };
+	sbits = sbits - (pos & (1009ULL << 52)) + (~pos & (1022ULL << 52));
+	scale = (__Float64x2_t) sbits;
+	y = scale + scale * tmp;
+
+	/* Round y to the right precision before scaling it into the
+	   subnormal range to avoid double rounding.  */
+	tiny = ~pos & (__Uint64x2_t) (y < one);
+	lo = scale - y + scale * tmp;
+	hi = one + y;
+	lo = one - hi + y + lo;
+	hi = hi + lo - one;
+	/* Avoid -0.0 with downward rounding.  */
+	hi = (__Float64x2_t) ((__Uint64x2_t) (hi != 0) & (__Uint64x2_t) hi);
+	y = select_v2df (tiny, hi, y);
+
+	return y * select_v2df (pos, (__Float64x2_t) { 0x1p1009, 0x1p1009 },
+				(__Float64x2_t) { 0x1p-1022, 0x1p-1022 });
+}
+
+/* Float counterpart for the table-free float kernels: compute
+   2^N * (1 + P) where E holds N shifted into the exponent field, for
+   lanes with |N| > 126 where the scale itself is not representable.
+   2^N is split into two factors, lanes with |N| > 192 overflow to inf
+   or underflow to zero directly.  */
+static __always_inline
+__Float32x4_t expf_specialcase_v4sf (__Float32x4_t p, __Float32x4_t n,
+				     __Uint32x4_t e)
+{
+	__Float32x4_t s1, s2, r1, r2;
+	__Uint32x4_t b, huge;
+
+	b = (__Uint32x4_t) (n <= 0) & 0x82000000;
+	s1 = (__Float32x4_t) (b + 0x7f000000);
+	s2 = (__Float32x4_t) (e - b);
+	huge = (__Uint32x4_t) (__builtin_aarch64_absv4sf (n) > 192);
+	r2 = s1 * s1;
+	r1 = __builtin_aarch64_fmav4sf (s2, p, s2) * s1;
+	return select_v4sf (huge, r2, r1);
+}
+
+/* Overwrite the lanes of the vector result Y selected by SPECIAL with
+   the scalar routine F applied to the matching lanes of X.  Only the
+   marked lanes pay for a scalar call.  */
+static __always_inline
+__Float64x2_t fixup_v2df (double (*f) (double), __Float64x2_t x,
+			  __Float64x2_t y, __Uint64x2_t special)
+{
+	if (special[0])
+		y[0] = f (x[0]);
+	if (special[1])
+		y[1] = f (x[1]);
+	return y;
+}
+
+static __always_inline
+__Float64x2_t fixup2_v2df (double (*f) (double, double), __Float64x2_t x,
+			   __Float64x2_t x2, __Float64x2_t y,
+			   __Uint64x2_t special)
+{
+	if (special[0])
+		y[0] = f (x[0], x2[0]);
+	if (special[1])
+		y[1] = f (x[1], x2[1]);
+	return y;
+}
+
+static __always_inline
+__Float32x4_t fixup_v4sf (float (*f) (float), __Float32x4_t x,
+			  __Float32x4_t y, __Uint32x4_t special)
+{
+	if (special[0])
+		y[0] = f (x[0]);
+	if (special[1])
+		y[1] = f (x[1]);
+	if (special[2])
+		y[2] = f (x[2]);
+	if (special[3])
+		y[3] = f (x[3]);
+	return y;
+}
+
+static __always_inline
+__Float32x4_t fixup2_v4sf (float (*f) (float, float), __Float32x4_t x,
+			   __Float32x4_t x2, __Float32x4_t y,
+			   __Uint32x4_t special)
+{
+	if (special[0])
+		y[0] = f (x[0], x2[0]);
+	if (special[1])
+		y[1] = f (x[1], x2[1]);
+	if (special[2])
+		y[2] = f (x[2], x2[2]);
+	if (special[3])
+		y[3] = f (x[3], x2[3]);
+	return y;
+}
+
+/* Array entry points, see libmvec_array.h.  FNAME applies the inline
+   vector kernel KERNEL to the N elements of IN and stores the results
+   to OUT, which may be the same array as IN.  The main loop loads WAYS
+   vectors before it stores any result, so that the table loads and
+   FMAs of WAYS independent vectors can be interleaved, and
+   LIBMVEC_ARRAY_ENTRY picks WAYS for the core.  The last partial
+   vector repeats its final element instead of calling the scalar
+   routine.  */
+#define LIBMVEC_MAX_WAYS 4
+#define LIBMVEC_UNROLL _Pragma ("GCC unroll 4")
+
+#define LIBMVEC_ARRAY_V2DF(fname, kernel)				\
+static __always_inline void						\
+fname##_ways (const double *in, double *out, size_t n, const int ways)	\
+{									\
+  __Float64x2_t x[LIBMVEC_MAX_WAYS];					\
+  size_t i;								\
+  int k;								\
+									\
+  for (i = 0; i + 2 * ways <= n; i += 2 * ways)				\
+    {									\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	__builtin_memcpy (&x[k], in + i + 2 * k, sizeof (x[k]));	\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	x[k] = kernel (x[k]);						\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	__builtin_memcpy (out + i + 2 * k, &x[k], sizeof (x[k]));	\
+    }									\
+  for (; i + 2 <= n; i += 2)						\
+    {									\
+      __builtin_memcpy (&x[0], in + i, sizeof (x[0]));			\
+      x[0] = kernel (x[0]);						\
+      __builtin_memcpy (out + i, &x[0], sizeof (x[0]));		\
+    }									\
+  if (i < n)								\
+    {									\
+      x[0] = kernel ((__Float64x2_t) { in[i], in[i] });		\
+      out[i] = x[0][0];							\
+    }									\
+}									\
+LIBMVEC_ARRAY_ENTRY (fname, (const double *in, double *out, size_t n),	\
+		     (in, out, n))
+
+#define LIBMVEC_ARRAY2_V2DF(fname, kernel)				\
+static __always_inline void						\
+fname##_ways (const double *in, const double *in2, double *out,	\
+	      size_t n, const int ways)					\
+{									\
+  __Float64x2_t x[LIBMVEC_MAX_WAYS], y[LIBMVEC_MAX_WAYS];		\
+  size_t i;								\
+  int k;								\
+									\
+  for (i = 0; i + 2 * ways <= n; i += 2 * ways)				\
+    {									\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	{								\
+	  __builtin_memcpy (&x[k], in + i + 2 * k, sizeof (x[k]));	\
+	  __builtin_memcpy (&y[k], in2 + i + 2 * k, sizeof (y[k]));	\
+	}								\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	x[k] = kernel (x[k], y[k]);					\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	__builtin_memcpy (out + i + 2 * k, &x[k], sizeof (x[k]));	\
+    }									\
+  for (; i + 2 <= n; i += 2)						\
+    {									\
+      __builtin_memcpy (&x[0], in + i, sizeof (x[0]));			\
+      __builtin_memcpy (&y[0], in2 + i, sizeof (y[0]));		\
+      x[0] = kernel (x[0], y[0]);					\
+      __builtin_memcpy (out + i, &x[0], sizeof (x[0]));		\
+    }									\
+  if (i < n)								\
+    {									\
+      x[0] = kernel ((__Float64x2_t) { in[i], in[i] },			\
+		     (__Float64x2_t) { in2[i], in2[i] });		\
+      out[i] = x[0][0];							\
+    }									\
+}									\
+LIBMVEC_ARRAY_ENTRY (fname, (const double *in, const double *in2,	\
+			     double *out, size_t n), (in, in2, out, n))
+
+/* For a KERNEL (x, &s, &c) computing two results of one input.  */
+#define LIBMVEC_ARRAY_SINCOS_V2DF(fname, kernel)			\
+static __always_inline void						\
+fname##_ways (const double *in, double *out, double *out2, size_t n,	\
+	      const int ways)						\
+{									\
+  __Float64x2_t x[LIBMVEC_MAX_WAYS], s[LIBMVEC_MAX_WAYS];		\
+  __Float64x2_t c[LIBMVEC_MAX_WAYS];					\
+  size_t i;								\
+  int k;								\
+									\
+  for (i = 0; i + 2 * ways <= n; i += 2 * ways)				\
+    {									\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	__builtin_memcpy (&x[k], in + i + 2 * k, sizeof (x[k]));	\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	kernel (x[k], &s[k], &c[k]);					\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	{								\
+	  __builtin_memcpy (out + i + 2 * k, &s[k], sizeof (s[k]));	\
+	  __builtin_memcpy (out2 + i + 2 * k, &c[k], sizeof (c[k]));	\
+	}								\
+    }									\
+  for (; i + 2 <= n; i += 2)						\
+    {									\
+      __builtin_memcpy (&x[0], in + i, sizeof (x[0]));			\
+      kernel (x[0], &s[0], &c[0]);					\
+      __builtin_memcpy (out + i, &s[0], sizeof (s[0]));		\
+      __builtin_memcpy (out2 + i, &c[0], sizeof (c[0]));		\
+    }									\
+  if (i < n)								\
+    {									\
+      kernel ((__Float64x2_t) { in[i], in[i] }, &s[0], &c[0]);		\
+      out[i] = s[0][0];							\
+      out2[i] = c[0][0];						\
+    }									\
+}									\
+LIBMVEC_ARRAY_ENTRY (fname, (const double *in, double *out,		\
+			     double *out2, size_t n), (in, out, out2, n))
+
+#define LIBMVEC_ARRAY_V4SF(fname, kernel)				\
+static __always_inline void						\
+fname##_ways (const float *in, float *out, size_t n, const int ways)	\
+{									\
+  __Float32x4_t x[LIBMVEC_MAX_WAYS];					\
+  size_t i, j;								\
+  int k;								\
+									\
+  for (i = 0; i + 4 * ways <= n; i += 4 * ways)				\
+    {									\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	__builtin_memcpy (&x[k], in + i + 4 * k, sizeof (x[k]));	\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	x[k] = kernel (x[k]);						\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	__builtin_memcpy (out + i + 4 * k, &x[k], sizeof (x[k]));	\
+    }									\
+  for (; i + 4 <= n; i += 4)						\
+    {									\
+      __builtin_memcpy (&x[0], in + i, sizeof (x[0]));			\
+      x[0] = kernel (x[0]);						\
+      __builtin_memcpy (out + i, &x[0], sizeof (x[0]));		\
+    }									\
+  if (i < n)								\
+    {									\
+      for (j = 0; j < 4; j++)						\
+	x[0][j] = in[i + j < n ? i + j : n - 1];			\
+      x[0] = kernel (x[0]);						\
+      for (j = 0; i + j < n; j++)					\
+	out[i + j] = x[0][j];						\
+    }									\
+}									\
+LIBMVEC_ARRAY_ENTRY (fname, (const float *in, float *out, size_t n),	\
+		     (in, out, n))
+
+#define LIBMVEC_ARRAY2_V4SF(fname, kernel)				\
+static __always_inline void						\
+fname##_ways (const float *in, const float *in2, float *out, size_t n,	\
+	      const int ways)						\
+{									\
+  __Float32x4_t x[LIBMVEC_MAX_WAYS], y[LIBMVEC_MAX_WAYS];		\
+  size_t i, j;								\
+  int k;								\
+									\
+  for (i = 0; i + 4 * ways <= n; i += 4 * ways)				\
+    {									\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	{								\
+	  __builtin_memcpy (&x[k], in + i + 4 * k, sizeof (x[k]));	\
+	  __builtin_memcpy (&y[k], in2 + i + 4 * k, sizeof (y[k]));	\
+	}								\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	x[k] = kernel (x[k], y[k]);					\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	__builtin_memcpy (out + i + 4 * k, &x[k], sizeof (x[k]));	\
+    }									\
+  for (; i + 4 <= n; i += 4)						\
+    {									\
+      __builtin_memcpy (&x[0], in + i, sizeof (x[0]));			\
+      __builtin_memcpy (&y[0], in2 + i, sizeof (y[0]));		\
+      x[0] = kernel (x[0], y[0]);					\
+      __builtin_memcpy (out + i, &x[0], sizeof (x[0]));		\
+    }									\
+  if (i < n)								\
+    {									\
+      for (j = 0; j < 4; j++)						\
+	{								\
+	  x[0][j] = in[i + j < n ? i + j : n - 1];			\
+	  y[0][j] = in2[i + j < n ? i + j : n - 1];			\
+	}								\
+      x[0] = kernel (x[0], y[0]);					\
+      for (j = 0; i + j < n; j++)					\
+	out[i + j] = x[0][j];						\
+    }									\
+}									\
+LIBMVEC_ARRAY_ENTRY (fname, (const float *in, const float *in2,	\
+			     float *out, size_t n), (in, in2, out, n))
+
+/* For a KERNEL (x, &s, &c) computing two results of one input.  */
+#define LIBMVEC_ARRAY_SINCOS_V4SF(fname, kernel)			\
+static __always_inline void						\
+fname##_ways (const float *in, float *out, float *out2, size_t n,	\
+	      const int ways)						\
+{									\
+  __Float32x4_t x[LIBMVEC_MAX_WAYS], s[LIBMVEC_MAX_WAYS];		\
+  __Float32x4_t c[LIBMVEC_MAX_WAYS];					\
+  size_t i, j;								\
+  int k;								\
+									\
+  for (i = 0; i + 4 * ways <= n; i += 4 * ways)				\
+    {									\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	__builtin_memcpy (&x[k], in + i + 4 * k, sizeof (x[k]));	\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	kernel (x[k], &s[k], &c[k]);					\
+      LIBMVEC_UNROLL							\
+      for (k = 0; k < ways; k++)					\
+	{								\
+	  __builtin_memcpy (out + i + 4 * k, &s[k], sizeof (s[k]));	\
+	  __builtin_memcpy (out2 + i + 4 * k, &c[k], sizeof (c[k]));	\
+	}								\
+    }									\
+  for (; i + 4 <= n; i += 4)						\
+    {									\
+      __builtin_memcpy (&x[0], in + i, sizeof (x[0]));			\
+      kernel (x[0], &s[0], &c[0]);					\
+      __builtin_memcpy (out + i, &s[0], sizeof (s[0]));		\
+      __builtin_memcpy (out2 + i, &c[0], sizeof (c[0]));		\
+    }									\
+  if (i < n)								\
+    {									\
+      for (j = 0; j < 4; j++)						\
+	x[0][j] = in[i + j < n ? i + j : n - 1];			\
+      kernel (x[0], &s[0], &c[0]);					\
+      for (j = 0; i + j < n; j++)					\
+	{								\
+	  out[i + j] = s[0][j];						\
+	  out2[i + j] = c[0][j];					\
+	}								\
+    }									\
+}									\
+LIBMVEC_ARRAY_ENTRY (fname, (const float *in, float *out,		\
+			     float *out2, size_t n), (in, out, out2, n))
+
+/* The _ZGVnN* entry points, one call of the inline kernel.  They are
+   not dispatched per core.  A variant with a separate multiply and add
+   instead of FMLA is not an option: the log and sine reductions rely
+   on the single rounding of __builtin_aarch64_fma* for exact products,
+   and elsewhere the extra rounding would change results, and the
+   bounds above, with the core the program runs on.  FMLA is part of
+   every AdvSIMD implementation, so there is no core that needs it.
+   That leaves the instruction schedule.  Within one call the
+   dependency chains of a kernel leave little to choose from.  The
+   array functions below have independent vectors to interleave, and
+   they are dispatched per core.  */
+#define LIBMVEC_ENTRY(type, name, params, args, kernel)			\
+__AARCH64_VECTOR_PCS_ATTR type						\
+name params								\
+{									\
+  return kernel args;							\
+}
+
+#define LIBMVEC_ENTRY_VOID(name, params, args, kernel)			\
+__AARCH64_VECTOR_PCS_ATTR void						\
+name params								\
+{									\
+  kernel args;								\
+}
+
+#define LIBMVEC_ARGS(...) __VA_ARGS__
+
+/* Runtime dispatch of the array entry points between interleave
+   widths.  Four vectors in flight suit cores with four SIMD pipes
+   (Neoverse V1) and cores whose long FMA latency needs the extra
+   independent work (ThunderX2); on the two pipe Neoverse N1 and N2
+   two vectors already fill the pipes, and the smaller loop body saves
+   the spills of four interleaved kernels.  Unknown cores get four
+   ways, as before.  The MIDR the resolver sees can be overridden with
+   the glibc.cpu.name tunable, e.g. GLIBC_TUNABLES=glibc.cpu.name=ares
+   selects the two way copies.  Building with LIBMVEC_NO_IFUNC gives
+   plain four way entry points.  */
+#ifdef LIBMVEC_NO_IFUNC
+
+#define LIBMVEC_ARRAY_ENTRY(fname, params, args)			\
+void									\
+fname params								\
+{									\
+  fname##_ways (LIBMVEC_ARGS args, 4);					\
+}
+
+#else
+
+#include <init-arch.h>
+
+static inline int
+libmvec_array_ways (void)
+{
+	INIT_ARCH ();
+#ifdef IS_NEOVERSE_N1
+	if (IS_NEOVERSE_N1 (midr))
+		return 2;
+#endif
+#ifdef IS_NEOVERSE_N2
+	if (IS_NEOVERSE_N2 (midr))
+		return 2;
+#endif
+	return 4;
+}
+
+#define LIBMVEC_ARRAY_ENTRY(fname, params, args)			\
+static void								\
+fname##_x2 params							\
+{									\
+  fname##_ways (LIBMVEC_ARGS args, 2);					\
+}									\
+									\
+static void								\
+fname##_x4 params							\
+{									\
+  fname##_ways (LIBMVEC_ARGS args, 4);					\
+}									\
+									\
+static __typeof (fname##_x4) *						\
+fname##_resolver (void)							\
+{									\
+  return libmvec_array_ways () == 2 ? fname##_x2 : fname##_x4;		\
+}									\
+									\
+void fname params __attribute__ ((ifunc (#fname "_resolver")));
+
+#endif
+
+#endif
@@ -0,0 +1,440 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Lane independence of the _ZGVnN* and _ZGVnM* entry points.  Build
+   with
+
+     gcc -O2 -o libmvec-lanes tests/libmvec_lanes.c libmvec.a -lm
+
+   and run ./libmvec-lanes [FUNCTION...].
+
+   Every value of the lists below is placed in each lane in turn while
+   the other lanes take every other value of the list: zeros,
+   subnormals, nan, inf, overflow and underflow arguments, arguments
+   past the large reduction cutoffs and the near-one bounds.  Those
+   neighbours send the vector through the any_lane_* branches, the
+   select_* patches, the scalar fixups and the vector large reduction,
+   and the result of the lane must stay the same as when all lanes hold
+   its value.  Results are compared bitwise, except that any nan matches
+   any nan.  The masked variants additionally get every mask with the
+   lane active, and sincos is checked through the l8l8 and vvv forms,
+   masked and unmasked.  The masked sincos forms must leave the
+   destinations of inactive lanes untouched.  The exit status is 1 if
+   any lane changes.  */
+
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef double v2df __attribute__ ((vector_size (16)));
+typedef float v4sf __attribute__ ((vector_size (16)));
+typedef uint64_t v2di __attribute__ ((vector_size (16)));
+typedef uint32_t v4si __attribute__ ((vector_size (16)));
+
+#define DECL_V2DF(f)							\
+  extern v2df _ZGVnN2v_##f (v2df);					\
+  extern v2df _ZGVnM2v_##f (v2df, v2di);
+#define DECL_V2DF2(f)							\
+  extern v2df _ZGVnN2vv_##f (v2df, v2df);				\
+  extern v2df _ZGVnM2vv_##f (v2df, v2df, v2di);
+#define DECL_V4SF(f)							\
+  extern v4sf _ZGVnN4v_##f (v4sf);					\
+  extern v4sf _ZGVnM4v_##f (v4sf, v4si);
+#define DECL_V4SF2(f)							\
+  extern v4sf _ZGVnN4vv_##f (v4sf, v4sf);				\
+  extern v4sf _ZGVnM4vv_##f (v4sf, v4sf, v4si);
+
+DECL_V2DF (exp) DECL_V2DF (exp2) DECL_V2DF (exp10) DECL_V2DF (expm1)
+DECL_V2DF (log) DECL_V2DF (log2) DECL_V2DF (log10) DECL_V2DF (log1p)
+DECL_V2DF2 (pow) DECL_V2DF (sin) DECL_V2DF (cos) DECL_V2DF (tan)
+DECL_V2DF (atan) DECL_V2DF2 (atan2) DECL_V2DF (asin) DECL_V2DF (acos)
+DECL_V2DF (sinh) DECL_V2DF (cosh) DECL_V2DF (tanh)
+DECL_V4SF (expf) DECL_V4SF (exp2f) DECL_V4SF (exp10f) DECL_V4SF (expm1f)
+DECL_V4SF (logf) DECL_V4SF (log2f) DECL_V4SF (log10f) DECL_V4SF (log1pf)
+DECL_V4SF2 (powf) DECL_V4SF (sinf) DECL_V4SF (cosf) DECL_V4SF (tanf)
+DECL_V4SF (atanf) DECL_V4SF2 (atan2f) DECL_V4SF (asinf) DECL_V4SF (acosf)
+DECL_V4SF (sinhf) DECL_V4SF (coshf) DECL_V4SF (tanhf)
+extern void _ZGVnN2vl8l8_sincos (v2df, double *, double *);
+extern void _ZGVnN2vvv_sincos (v2df, v2di, v2di);
+extern void _ZGVnM2vl8l8_sincos (v2df, double *, double *, v2di);
+extern void _ZGVnM2vvv_sincos (v2df, v2di, v2di, v2di);
+extern void _ZGVnN4vl4l4_sincosf (v4sf, float *, float *);
+extern void _ZGVnN4vvv_sincosf (v4sf, v2di, v2di, v2di, v2di);
+extern void _ZGVnM4vl4l4_sincosf (v4sf, float *, float *, v4si);
+extern void _ZGVnM4vvv_sincosf (v4sf, v2di, v2di, v2di, v2di, v4si);
+
+enum kind { V2DF, V2DF2, V4SF, V4SF2, SINCOS, SINCOSF };
+
+struct func
+{
+  const char *name;
+  enum kind kind;
+  void (*vec) (void);
+  void (*masked) (void);
+};
+
+#define F(k, name, n, m)						\
+  { #name, k, (void (*) (void)) n##_##name, (void (*) (void)) m##_##name }
+
+static const struct func funcs[] = {
+  F (V2DF, exp, _ZGVnN2v, _ZGVnM2v), F (V2DF, exp2, _ZGVnN2v, _ZGVnM2v),
+  F (V2DF, exp10, _ZGVnN2v, _ZGVnM2v), F (V2DF, expm1, _ZGVnN2v, _ZGVnM2v),
+  F (V2DF, log, _ZGVnN2v, _ZGVnM2v), F (V2DF, log2, _ZGVnN2v, _ZGVnM2v),
+  F (V2DF, log10, _ZGVnN2v, _ZGVnM2v), F (V2DF, log1p, _ZGVnN2v, _ZGVnM2v),
+  F (V2DF2, pow, _ZGVnN2vv, _ZGVnM2vv), F (V2DF, sin, _ZGVnN2v, _ZGVnM2v),
+  F (V2DF, cos, _ZGVnN2v, _ZGVnM2v), F (V2DF, tan, _ZGVnN2v, _ZGVnM2v),
+  F (V2DF, atan, _ZGVnN2v, _ZGVnM2v), F (V2DF2, atan2, _ZGVnN2vv, _ZGVnM2vv),
+  F (V2DF, asin, _ZGVnN2v, _ZGVnM2v), F (V2DF, acos, _ZGVnN2v, _ZGVnM2v),
+  F (V2DF, sinh, _ZGVnN2v, _ZGVnM2v), F (V2DF, cosh, _ZGVnN2v, _ZGVnM2v),
+  F (V2DF, tanh, _ZGVnN2v, _ZGVnM2v),
+  { "sincos", SINCOS, NULL, NULL },
+  F (V4SF, expf, _ZGVnN4v, _ZGVnM4v), F (V4SF, exp2f, _ZGVnN4v, _ZGVnM4v),
+  F (V4SF, exp10f, _ZGVnN4v, _ZGVnM4v), F (V4SF, expm1f, _ZGVnN4v, _ZGVnM4v),
+  F (V4SF, logf, _ZGVnN4v, _ZGVnM4v), F (V4SF, log2f, _ZGVnN4v, _ZGVnM4v),
+  F (V4SF, log10f, _ZGVnN4v, _ZGVnM4v), F (V4SF, log1pf, _ZGVnN4v, _ZGVnM4v),
+  F (V4SF2, powf, _ZGVnN4vv, _ZGVnM4vv), F (V4SF, sinf, _ZGVnN4v, _ZGVnM4v),
+  F (V4SF, cosf, _ZGVnN4v, _ZGVnM4v), F (V4SF, tanf, _ZGVnN4v, _ZGVnM4v),
+  F (V4SF, atanf, _ZGVnN4v, _ZGVnM4v), F (V4SF2, atan2f, _ZGVnN4vv, _ZGVnM4vv),
+  F (V4SF, asinf, _ZGVnN4v, _ZGVnM4v), F (V4SF, acosf, _ZGVnN4v, _ZGVnM4v),
+  F (V4SF, sinhf, _ZGVnN4v, _ZGVnM4v), F (V4SF, coshf, _ZGVnN4v, _ZGVnM4v),
+  F (V4SF, tanhf, _ZGVnN4v, _ZGVnM4v),
+  { "sincosf", SINCOSF, NULL, NULL },
+};
+
+/* Lane values, converted to float for the float functions.  The
+   second list is used for the second argument of pow and atan2.  */
+static const double values[] = {
+  0.0, -0.0, 1.0, -1.0, 0.5, -0.5, 2.0, 3.0, -3.0, 0x1p-30, -0x1p-30,
+  1 - 0x1p-10, 1 + 0x1p-10, 1 - 0x1p-4, 1 + 0x1.09p-4, 0x1p-4, 0.75,
+  0x1p-1074, -0x1p-1074, 0x1p-1030, 0x1p-140, -0x1p-140, 0x1p-126,
+  DBL_MIN, FLT_MIN, DBL_MAX, -DBL_MAX, FLT_MAX, -FLT_MAX,
+  INFINITY, -INFINITY, NAN, -NAN,
+  10.5, -10.5, 25.0, 40.5, -40.5, 89.0, -104.0, 150.5, -150.5, 220.5,
+  600.0, -600.0, 709.0, 710.0, -745.0, -746.0, 1100.0, -1100.0,
+  1000.5, -1000.5, 0x1p20, 0x1.2p20, 1e6, -1e6, 0x1p53, 1e300, -1e300,
+  0x1.921fb54442d18p0, 0x1.921fb54442d18p1,
+};
+
+static const double yvalues[] = {
+  1.0, 0.5, 2.0, -2.0, 3.0, -3.0, 0.0, -0.0, 1e10, -1e10, 0x1p53,
+  0x1p-1074, DBL_MAX, INFINITY, -INFINITY, NAN, -1.5, 1000.5,
+};
+
+/* Initial contents of the sincos destinations, outside [-1, 1] so
+   that no sin or cos result matches it.  */
+#define UNTOUCHED 0x1.abcdep77
+
+#define NV (sizeof (values) / sizeof (values[0]))
+#define NY (sizeof (yvalues) / sizeof (yvalues[0]))
+
+static int
+same (double a, double b)
+{
+  return isnan (a) ? isnan (b) : memcmp (&a, &b, sizeof (a)) == 0;
+}
+
+static int
+samef (float a, float b)
+{
+  return isnan (a) ? isnan (b) : memcmp (&a, &b, sizeof (a)) == 0;
+}
+
+static unsigned long failures;
+
+static void
+fail (const struct func *f, const char *form, int lane, double x, double y,
+      double nx, double ny, unsigned mask, double got, double want)
+{
+  if (failures++ < 20)
+    printf ("%s %s: lane %d x=%a y=%a changes to %a from %a with"
+	    " neighbours x=%a y=%a mask=%#x\n", f->name, form, lane, x, y,
+	    got, want, nx, ny, mask);
+}
+
+/* Evaluate the two lane double function F on X and Y, and the masked
+   form with MASK (bit I is lane I) if MASK is nonzero.  For sincos
+   R2 gets cos.  */
+static void
+eval_v2df (const struct func *f, v2df x, v2df y, unsigned mask, int vvv,
+	   v2df *r, v2df *r2)
+{
+  v2di m = { -(uint64_t) (mask & 1), -(uint64_t) ((mask >> 1) & 1) };
+
+  switch (f->kind)
+    {
+    case V2DF:
+      if (mask)
+	*r = ((v2df (*) (v2df, v2di)) f->masked) (x, m);
+      else
+	*r = ((v2df (*) (v2df)) f->vec) (x);
+      break;
+    case V2DF2:
+      if (mask)
+	*r = ((v2df (*) (v2df, v2df, v2di)) f->masked) (x, y, m);
+      else
+	*r = ((v2df (*) (v2df, v2df)) f->vec) (x, y);
+      break;
+    case SINCOS:
+      if (vvv)
+	{
+	  /* Scattered destinations, cos before sin in memory.  */
+	  double buf[8] = { UNTOUCHED, UNTOUCHED, UNTOUCHED, UNTOUCHED,
+			    UNTOUCHED, UNTOUCHED, UNTOUCHED, UNTOUCHED };
+	  v2di sp = { (uintptr_t) &buf[5], (uintptr_t) &buf[1] };
+	  v2di cp = { (uintptr_t) &buf[0], (uintptr_t) &buf[6] };
+
+	  if (mask)
+	    _ZGVnM2vvv_sincos (x, sp, cp, m);
+	  else
+	    _ZGVnN2vvv_sincos (x, sp, cp);
+	  *r = (v2df) { buf[5], buf[1] };
+	  *r2 = (v2df) { buf[0], buf[6] };
+	}
+      else
+	{
+	  double s[2] = { UNTOUCHED, UNTOUCHED };
+	  double c[2] = { UNTOUCHED, UNTOUCHED };
+
+	  if (mask)
+	    _ZGVnM2vl8l8_sincos (x, s, c, m);
+	  else
+	    _ZGVnN2vl8l8_sincos (x, s, c);
+	  *r = (v2df) { s[0], s[1] };
+	  *r2 = (v2df) { c[0], c[1] };
+	}
+      break;
+    default:
+      break;
+    }
+}
+
+static void
+eval_v4sf (const struct func *f, v4sf x, v4sf y, unsigned mask, int vvv,
+	   v4sf *r, v4sf *r2)
+{
+  v4si m = { -(mask & 1), -((mask >> 1) & 1), -((mask >> 2) & 1),
+	     -((mask >> 3) & 1) };
+
+  switch (f->kind)
+    {
+    case V4SF:
+      if (mask)
+	*r = ((v4sf (*) (v4sf, v4si)) f->masked) (x, m);
+      else
+	*r = ((v4sf (*) (v4sf)) f->vec) (x);
+      break;
+    case V4SF2:
+      if (mask)
+	*r = ((v4sf (*) (v4sf, v4sf, v4si)) f->masked) (x, y, m);
+      else
+	*r = ((v4sf (*) (v4sf, v4sf)) f->vec) (x, y);
+      break;
+    case SINCOSF:
+      if (vvv)
+	{
+	  float buf[16];
+	  int i;
+	  v2di sp0 = { (uintptr_t) &buf[9], (uintptr_t) &buf[2] };
+	  v2di sp1 = { (uintptr_t) &buf[14], (uintptr_t) &buf[0] };
+	  v2di cp0 = { (uintptr_t) &buf[7], (uintptr_t) &buf[11] };
+	  v2di cp1 = { (uintptr_t) &buf[4], (uintptr_t) &buf[13] };
+
+	  for (i = 0; i < 16; i++)
+	    buf[i] = UNTOUCHED;
+	  if (mask)
+	    _ZGVnM4vvv_sincosf (x, sp0, sp1, cp0, cp1, m);
+	  else
+	    _ZGVnN4vvv_sincosf (x, sp0, sp1, cp0, cp1);
+	  *r = (v4sf) { buf[9], buf[2], buf[14], buf[0] };
+	  *r2 = (v4sf) { buf[7], buf[11], buf[4], buf[13] };
+	}
+      else
+	{
+	  float s[4] = { UNTOUCHED, UNTOUCHED, UNTOUCHED, UNTOUCHED };
+	  float c[4] = { UNTOUCHED, UNTOUCHED, UNTOUCHED, UNTOUCHED };
+
+	  if (mask)
+	    _ZGVnM4vl4l4_sincosf (x, s, c, m);
+	  else
+	    _ZGVnN4vl4l4_sincosf (x, s, c);
+	  *r = (v4sf) { s[0], s[1], s[2], s[3] };
+	  *r2 = (v4sf) { c[0], c[1], c[2], c[3] };
+	}
+      break;
+    default:
+      break;
+    }
+}
+
+/* Form 0 is the plain entry point, form 1 the masked one.  sincos
+   has four forms, bit 0 selects vvv over l8l8 or l4l4 and bit 1 the
+   masked variant.  COS names the cos result of sincos.  */
+static const char *
+form_name (const struct func *f, int form, int cos)
+{
+  static const char *const sincos_names[2][4] = {
+    { "l8l8", "vvv", "masked l8l8", "masked vvv" },
+    { "l8l8 cos", "vvv cos", "masked l8l8 cos", "masked vvv cos" },
+  };
+  static const char *const sincosf_names[2][4] = {
+    { "l4l4", "vvv", "masked l4l4", "masked vvv" },
+    { "l4l4 cos", "vvv cos", "masked l4l4 cos", "masked vvv cos" },
+  };
+
+  if (f->kind == SINCOS)
+    return sincos_names[cos][form];
+  if (f->kind == SINCOSF)
+    return sincosf_names[cos][form];
+  return form ? "masked" : "plain";
+}
+
+static int
+nforms (const struct func *f)
+{
+  return f->kind == SINCOS || f->kind == SINCOSF ? 4 : 2;
+}
+
+static int
+is_masked (const struct func *f, int form)
+{
+  return f->kind == SINCOS || f->kind == SINCOSF ? form >> 1 : form;
+}
+
+static void
+test_v2df (const struct func *f)
+{
+  size_t i, j, k, l, ny = f->kind == V2DF2 ? NY : 1;
+  int lane, form, other;
+  unsigned mask;
+
+  for (i = 0; i < NV; i++)
+    for (k = 0; k < ny; k++)
+      {
+	double x = values[i], y = yvalues[k];
+	v2df want, want2, got, got2;
+
+	eval_v2df (f, (v2df) { x, x }, (v2df) { y, y }, 0, 0, &want, &want2);
+	for (j = 0; j < NV; j++)
+	  for (l = 0; l < ny; l++)
+	    for (lane = 0; lane < 2; lane++)
+	      for (form = 0; form < nforms (f); form++)
+		for (mask = 1; mask < 4; mask++)
+		  {
+		    v2df vx = { values[j], values[j] };
+		    v2df vy = { yvalues[l], yvalues[l] };
+		    int masked = is_masked (f, form);
+
+		    if (!(mask & (1 << lane)) || (!masked && mask != 3))
+		      continue;
+		    vx[lane] = x;
+		    vy[lane] = y;
+		    eval_v2df (f, vx, vy, masked ? mask : 0, form & 1, &got,
+			       &got2);
+		    if (!same (got[lane], want[lane]))
+		      fail (f, form_name (f, form, 0), lane, x, y, values[j],
+			    yvalues[l], mask, got[lane], want[lane]);
+		    if (f->kind != SINCOS)
+		      continue;
+		    if (!same (got2[lane], want2[lane]))
+		      fail (f, form_name (f, form, 1), lane, x, y, values[j],
+			    yvalues[l], mask, got2[lane], want2[lane]);
+		    for (other = 0; other < 2; other++)
+		      if (!(mask & (1 << other))
+			  && (!same (got[other], UNTOUCHED)
+			      || !same (got2[other], UNTOUCHED)))
+			fail (f, form_name (f, form, 0), other, values[j],
+			      yvalues[l], x, y, mask, got[other], UNTOUCHED);
+		  }
+      }
+}
+
+static void
+test_v4sf (const struct func *f)
+{
+  size_t i, j, k, l, ny = f->kind == V4SF2 ? NY : 1;
+  int lane, form, other;
+  unsigned mask;
+
+  for (i = 0; i < NV; i++)
+    for (k = 0; k < ny; k++)
+      {
+	float x = values[i], y = yvalues[k];
+	v4sf want, want2, got, got2;
+
+	eval_v4sf (f, (v4sf) { x, x, x, x }, (v4sf) { y, y, y, y }, 0, 0,
+		   &want, &want2);
+	for (j = 0; j < NV; j++)
+	  for (l = 0; l < ny; l++)
+	    for (lane = 0; lane < 4; lane++)
+	      for (form = 0; form < nforms (f); form++)
+		for (mask = 1; mask < 16; mask++)
+		  {
+		    float nx = values[j], nyv = yvalues[l];
+		    v4sf vx = { nx, nx, nx, nx };
+		    v4sf vy = { nyv, nyv, nyv, nyv };
+		    int masked = is_masked (f, form);
+
+		    if (!(mask & (1 << lane)) || (!masked && mask != 15))
+		      continue;
+		    vx[lane] = x;
+		    vy[lane] = y;
+		    eval_v4sf (f, vx, vy, masked ? mask : 0, form & 1, &got,
+			       &got2);
+		    if (!samef (got[lane], want[lane]))
+		      fail (f, form_name (f, form, 0), lane, x, y, nx, nyv,
+			    mask, got[lane], want[lane]);
+		    if (f->kind != SINCOSF)
+		      continue;
+		    if (!samef (got2[lane], want2[lane]))
+		      fail (f, form_name (f, form, 1), lane, x, y, nx, nyv,
+			    mask, got2[lane], want2[lane]);
+		    for (other = 0; other < 4; other++)
+		      if (!(mask & (1 << other))
+			  && (!samef (got[other], UNTOUCHED)
+			      || !samef (got2[other], UNTOUCHED)))
+			fail (f, form_name (f, form, 0), other, nx, nyv, x, y,
+			      mask, got[other], UNTOUCHED);
+		  }
+      }
+}
+
+int
+main (int argc, char **argv)
+{
+  size_t k;
+  int i;
+
+  for (k = 0; k < sizeof (funcs) / sizeof (funcs[0]); k++)
+    {
+      const struct func *f = &funcs[k];
+      unsigned long before = failures;
+      int sel = argc == 1;
+
+      for (i = 1; i < argc; i++)
+	if (strcmp (argv[i], f->name) == 0)
+	  sel = 1;
+      if (!sel)
+	continue;
+      if (f->kind == V2DF || f->kind == V2DF2 || f->kind == SINCOS)
+	test_v2df (f);
+      else
+	test_v4sf (f);
+      printf ("%-8s %s\n", f->name, failures == before ? "ok" : "FAIL");
+    }
+  return failures != 0;
+}
@@ -0,0 +1,500 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* The _ZGVsMxv* entry points against the _ZGVnN* ones, lane by lane.
+   Build with
+
+     gcc -O2 -march=armv8.2-a+sve -o libmvec-sve tests/libmvec_sve.c \
+       libmvec.a -lm
+
+   and run ./libmvec-sve [-n SAMPLES] [FUNCTION...] on an SVE Linux
+   system.  Without one, link it with -static and run it under
+   qemu-user with the three lengths enabled:
+
+     qemu-aarch64 -cpu max,sve128=on,sve256=on,sve512=on ./libmvec-sve
+
+   The inputs are SAMPLES random values over the intervals listed for
+   each function plus the special values of libmvec_lanes.c.  They are
+   evaluated at vector lengths of 128, 256 and 512 bits, set with
+   prctl (PR_SVE_SET_VL); lengths the hardware does not offer are
+   reported and skipped.  Each length runs three passes: with all lanes
+   of the governing predicate active, with a random half of them
+   active, and with a prefix of each vector active, of every length
+   from one lane up, as svwhilelt gives for the last vector of a loop.
+   In the partial passes the inactive lanes hold nan,
+   inf, huge or subnormal values that would take the special paths, so
+   that they also check that inactive lanes do not leak into active
+   ones.  Only the active lanes are stored.
+
+   The SVE kernels use the same algorithms and tables as the AdvSIMD
+   ones, but round k with FRINTA where AdvSIMD adds a shift, and pow
+   and powf handle their special cases in the vector code, so results
+   may differ in the last bit.  A lane fails if its result differs from
+   the AdvSIMD result by more than 1 ulp, or if one is nan, inf or a
+   zero of some sign and the other is not the same.  The exit status is
+   1 if any lane fails.  */
+
+#define _GNU_SOURCE
+#include <arm_sve.h>
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/prctl.h>
+
+typedef double v2df __attribute__ ((vector_size (16)));
+typedef float v4sf __attribute__ ((vector_size (16)));
+
+#define DECL_F64(f)							\
+  extern v2df _ZGVnN2v_##f (v2df);					\
+  extern svfloat64_t _ZGVsMxv_##f (svfloat64_t, svbool_t);
+#define DECL_F64_2(f)							\
+  extern v2df _ZGVnN2vv_##f (v2df, v2df);				\
+  extern svfloat64_t _ZGVsMxvv_##f (svfloat64_t, svfloat64_t, svbool_t);
+#define DECL_F32(f)							\
+  extern v4sf _ZGVnN4v_##f (v4sf);					\
+  extern svfloat32_t _ZGVsMxv_##f (svfloat32_t, svbool_t);
+#define DECL_F32_2(f)							\
+  extern v4sf _ZGVnN4vv_##f (v4sf, v4sf);				\
+  extern svfloat32_t _ZGVsMxvv_##f (svfloat32_t, svfloat32_t, svbool_t);
+
+DECL_F64 (exp) DECL_F64 (exp2) DECL_F64 (log) DECL_F64 (log2)
+DECL_F64_2 (pow) DECL_F64 (sin) DECL_F64 (cos)
+DECL_F32 (expf) DECL_F32 (exp2f) DECL_F32 (logf) DECL_F32 (log2f)
+DECL_F32_2 (powf) DECL_F32 (sinf) DECL_F32 (cosf)
+
+/* Inputs: uniform in [LO, HI], or with LOG uniform in the exponent
+   between |LO| and |HI|, both signs if LO < 0.  */
+struct interval
+{
+  double lo, hi;
+  int log;
+};
+
+#define END { 0, 0, -1 }
+
+struct func
+{
+  const char *name;
+  int is_float;
+  int args;
+  void (*sve) (void);
+  void (*advsimd) (void);
+  const struct interval *x, *y;
+};
+
+#define F1(name, x) 							\
+  { #name, 0, 1, (void (*) (void)) _ZGVsMxv_##name,			\
+    (void (*) (void)) _ZGVnN2v_##name, x, NULL }
+#define F2(name, x, y)							\
+  { #name, 0, 2, (void (*) (void)) _ZGVsMxvv_##name,			\
+    (void (*) (void)) _ZGVnN2vv_##name, x, y }
+#define FF1(name, x)							\
+  { #name, 1, 1, (void (*) (void)) _ZGVsMxv_##name,			\
+    (void (*) (void)) _ZGVnN4v_##name, x, NULL }
+#define FF2(name, x, y)							\
+  { #name, 1, 2, (void (*) (void)) _ZGVsMxvv_##name,			\
+    (void (*) (void)) _ZGVnN4vv_##name, x, y }
+
+static const struct interval i_exp[] =
+  { { -746, 710, 0 }, { -0x1p-60, 1, 1 }, END };
+static const struct interval i_exp2[] =
+  { { -1076, 1025, 0 }, { -0x1p-60, 1, 1 }, END };
+static const struct interval i_log[] =
+  { { 0x1p-1074, DBL_MAX, 1 }, { 0.5, 2, 0 }, END };
+static const struct interval i_pow_x[] =
+  { { 1e-10, 1e10, 1 }, { 0.5, 2, 0 }, END };
+static const struct interval i_pow_y[] =
+  { { -30, 30, 0 }, { -1000, 1000, 0 }, END };
+static const struct interval i_trig[] =
+  { { -1000, 1000, 0 }, { -0x1p-60, 1, 1 }, { -1e3, 1e300, 1 }, END };
+static const struct interval f_exp[] =
+  { { -104, 89, 0 }, { -0x1p-30, 1, 1 }, END };
+static const struct interval f_exp2[] =
+  { { -151, 129, 0 }, { -0x1p-30, 1, 1 }, END };
+static const struct interval f_log[] =
+  { { 0x1p-149, FLT_MAX, 1 }, { 0.5, 2, 0 }, END };
+static const struct interval f_pow_x[] =
+  { { 1e-5, 1e5, 1 }, { 0.5, 2, 0 }, END };
+static const struct interval f_pow_y[] =
+  { { -10, 10, 0 }, { -150, 150, 0 }, END };
+static const struct interval f_trig[] =
+  { { -100, 100, 0 }, { -0x1p-30, 1, 1 }, { -1e2, FLT_MAX, 1 }, END };
+
+static const struct func funcs[] = {
+  F1 (exp, i_exp), F1 (exp2, i_exp2), F1 (log, i_log), F1 (log2, i_log),
+  F2 (pow, i_pow_x, i_pow_y), F1 (sin, i_trig), F1 (cos, i_trig),
+  FF1 (expf, f_exp), FF1 (exp2f, f_exp2), FF1 (logf, f_log),
+  FF1 (log2f, f_log), FF2 (powf, f_pow_x, f_pow_y), FF1 (sinf, f_trig),
+  FF1 (cosf, f_trig),
+};
+
+/* Special values, placed at the start of the inputs.  */
+static const double specials[] = {
+  0.0, -0.0, 1.0, -1.0, 0.5, -0.5, 2.0, 3.0, -3.0, 0x1p-30, -0x1p-30,
+  1 - 0x1p-10, 1 + 0x1p-10, 1 - 0x1p-4, 1 + 0x1.09p-4, 0x1p-4, 0.75,
+  0x1p-1074, -0x1p-1074, 0x1p-1030, 0x1p-140, -0x1p-140, 0x1p-126,
+  DBL_MIN, FLT_MIN, DBL_MAX, -DBL_MAX, FLT_MAX, -FLT_MAX,
+  INFINITY, -INFINITY, NAN, -NAN,
+  10.5, -10.5, 25.0, 40.5, -40.5, 89.0, -104.0, 150.5, -150.5, 220.5,
+  600.0, -600.0, 709.0, 710.0, -745.0, -746.0, 1100.0, -1100.0,
+  1000.5, -1000.5, 0x1p20, 0x1.2p20, 1e6, -1e6, 0x1p53, 1e300, -1e300,
+  0x1.921fb54442d18p0, 0x1.921fb54442d18p1,
+};
+#define NSPECIAL (sizeof (specials) / sizeof (specials[0]))
+
+/* Values for the inactive lanes.  */
+static const double poison[] = {
+  NAN, INFINITY, -INFINITY, 1e300, -1e300, 0x1p-1074, -0.0, 0x1p20,
+};
+#define NPOISON (sizeof (poison) / sizeof (poison[0]))
+
+enum pass { ALL, HALF, TAIL, NPASS };
+static const char *const pass_names[NPASS] = { "all", "half", "tail" };
+
+static size_t samples = 1 << 16;
+
+static uint64_t rng = 0x9e3779b97f4a7c15;
+
+static uint64_t
+next (void)
+{
+  rng ^= rng << 13;
+  rng ^= rng >> 7;
+  rng ^= rng << 17;
+  return rng;
+}
+
+/* A random value in one of the intervals of IV.  */
+static double
+sample (const struct interval *iv)
+{
+  const struct interval *i;
+  double u, x;
+  int n = 0, elo, ehi;
+
+  while (iv[n].log >= 0)
+    n++;
+  i = &iv[next () % n];
+  u = (next () >> 11) * 0x1p-53;
+  if (i->log)
+    {
+      elo = ilogb (fabs (i->lo));
+      ehi = ilogb (fabs (i->hi));
+      do
+	x = ldexp (1 + u, elo + (int) (next () % (ehi - elo + 1)));
+      while (x < fabs (i->lo) || x > fabs (i->hi));
+      if (i->lo < 0 && (next () & 1))
+	x = -x;
+      return x;
+    }
+  return i->lo + u * (i->hi - i->lo);
+}
+
+/* Distance in ulp of the target format, or -1 if the special value
+   classes differ.  */
+static double
+diff (double got, double want, int is_float)
+{
+  int e;
+
+  if (isnan (got) || isnan (want))
+    return isnan (got) && isnan (want) ? 0 : -1;
+  if (isinf (got) || isinf (want) || got == 0 || want == 0)
+    return memcmp (&got, &want, sizeof (got)) == 0 ? 0 : -1;
+  if (got == want)
+    return 0;
+  frexp (want, &e);
+  if (is_float)
+    e = e < FLT_MIN_EXP ? FLT_MIN_EXP : e;
+  else
+    e = e < DBL_MIN_EXP ? DBL_MIN_EXP : e;
+  return fabs (got - want)
+	 / ldexp (1.0, e - (is_float ? FLT_MANT_DIG : DBL_MANT_DIG));
+}
+
+/* Inputs for F, converted to float for the float functions.  */
+static void
+inputs (const struct func *f, double *x, double *y, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      x[i] = i < NSPECIAL ? specials[i] : sample (f->x);
+      if (f->args == 2)
+	y[i] = i % 7 == 0 ? specials[next () % NSPECIAL] : sample (f->y);
+    }
+}
+
+/* The AdvSIMD results for all N inputs.  N is a multiple of 4.  */
+static void
+reference (const struct func *f, const double *x, const double *y,
+	   double *r, size_t n)
+{
+  size_t i;
+  int j;
+
+  for (i = 0; i < n; i += 4)
+    if (f->is_float)
+      {
+	v4sf xv, yv, rv;
+
+	for (j = 0; j < 4; j++)
+	  {
+	    xv[j] = x[i + j];
+	    yv[j] = f->args == 2 ? y[i + j] : 0;
+	  }
+	if (f->args == 2)
+	  rv = ((v4sf (*) (v4sf, v4sf)) f->advsimd) (xv, yv);
+	else
+	  rv = ((v4sf (*) (v4sf)) f->advsimd) (xv);
+	for (j = 0; j < 4; j++)
+	  r[i + j] = rv[j];
+      }
+    else
+      for (j = 0; j < 4; j += 2)
+	{
+	  v2df xv = { x[i + j], x[i + j + 1] }, rv;
+
+	  if (f->args == 2)
+	    rv = ((v2df (*) (v2df, v2df)) f->advsimd)
+	      (xv, (v2df) { y[i + j], y[i + j + 1] });
+	  else
+	    rv = ((v2df (*) (v2df)) f->advsimd) (xv);
+	  r[i + j] = rv[0];
+	  r[i + j + 1] = rv[1];
+	}
+}
+
+/* The SVE results for the N lanes at X and Y.  ACTIVE[i] is nonzero
+   for the lanes evaluated, the others hold poison inputs and their
+   result slots are left alone.  */
+static void __attribute__ ((noinline))
+evaluate_f64 (const struct func *f, const double *x, const double *y,
+	      const uint64_t *active, double *r, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i += svcntd ())
+    {
+      svbool_t pg = svwhilelt_b64 (i, n);
+      svfloat64_t xv = svld1_f64 (pg, x + i), rv;
+
+      pg = svcmpne_n_u64 (pg, svld1_u64 (pg, active + i), 0);
+      if (f->args == 2)
+	rv = ((svfloat64_t (*) (svfloat64_t, svfloat64_t, svbool_t)) f->sve)
+	  (xv, svld1_f64 (svptrue_b64 (), y + i), pg);
+      else
+	rv = ((svfloat64_t (*) (svfloat64_t, svbool_t)) f->sve) (xv, pg);
+      svst1_f64 (pg, r + i, rv);
+    }
+}
+
+static void __attribute__ ((noinline))
+evaluate_f32 (const struct func *f, const float *x, const float *y,
+	      const uint32_t *active, float *r, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i += svcntw ())
+    {
+      svbool_t pg = svwhilelt_b32 (i, n);
+      svfloat32_t xv = svld1_f32 (pg, x + i), rv;
+
+      pg = svcmpne_n_u32 (pg, svld1_u32 (pg, active + i), 0);
+      if (f->args == 2)
+	rv = ((svfloat32_t (*) (svfloat32_t, svfloat32_t, svbool_t)) f->sve)
+	  (xv, svld1_f32 (svptrue_b32 (), y + i), pg);
+      else
+	rv = ((svfloat32_t (*) (svfloat32_t, svbool_t)) f->sve) (xv, pg);
+      svst1_f32 (pg, r + i, rv);
+    }
+}
+
+/* Run F over N inputs at the current vector length of VL bytes in
+   pass P.  Returns nonzero on failure.  */
+static int
+test (const struct func *f, size_t vl, enum pass p, const double *x,
+      const double *y, const double *want, size_t n)
+{
+  size_t lanes = vl / (f->is_float ? 4 : 8), m, i, j, nfail = 0, ndiff = 0;
+  double *xd, *yd, *rd, maxd = 0, d;
+  float *xs, *ys, *rs;
+  uint64_t *ad;
+  uint32_t *as;
+  size_t *from;
+
+  /* The HALF and TAIL passes spread the inputs over about twice as
+     many lanes, the inactive ones are poison.  */
+  m = (4 * n + lanes - 1) / lanes * lanes + 2 * lanes;
+  xd = calloc (m, sizeof (double));
+  yd = calloc (m, sizeof (double));
+  rd = calloc (m, sizeof (double));
+  ad = calloc (m, sizeof (uint64_t));
+  xs = calloc (m, sizeof (float));
+  ys = calloc (m, sizeof (float));
+  rs = calloc (m, sizeof (float));
+  as = calloc (m, sizeof (uint32_t));
+  from = calloc (m, sizeof (size_t));
+  if (!xd || !yd || !rd || !ad || !xs || !ys || !rs || !as || !from)
+    {
+      perror ("calloc");
+      exit (2);
+    }
+
+  for (j = 0; j < m; j++)
+    {
+      xd[j] = poison[next () % NPOISON];
+      yd[j] = poison[next () % NPOISON];
+      from[j] = n;
+    }
+  for (i = 0, j = 0; i < n; i++, j++)
+    {
+      if (p == HALF)
+	while ((next () & 1) && j + 2 * lanes < m)
+	  j++;
+      /* Vector V has its first V % LANES + 1 lanes active.  */
+      else if (p == TAIL && j % lanes > (j / lanes) % lanes)
+	j = (j / lanes + 1) * lanes;
+      xd[j] = x[i];
+      yd[j] = f->args == 2 ? y[i] : 0;
+      ad[j] = 1;
+      from[j] = i;
+    }
+  for (j = 0; j < m; j++)
+    {
+      xs[j] = xd[j];
+      ys[j] = yd[j];
+      as[j] = ad[j];
+    }
+
+  if (f->is_float)
+    evaluate_f32 (f, xs, ys, as, rs, m);
+  else
+    evaluate_f64 (f, xd, yd, ad, rd, m);
+
+  for (j = 0; j < m; j++)
+    {
+      double got;
+
+      if (from[j] == n)
+	continue;
+      i = from[j];
+      got = f->is_float ? rs[j] : rd[j];
+      d = diff (got, want[i], f->is_float);
+      if (d != 0)
+	ndiff++;
+      if (d < 0 || d > 1)
+	{
+	  if (nfail++ == 0)
+	    {
+	      printf ("%-6s VL %4zu %-4s FAIL at x=%a", f->name, vl * 8,
+		      pass_names[p], x[i]);
+	      if (f->args == 2)
+		printf (" y=%a", y[i]);
+	      printf (" lane %zu got %a want %a\n", j % lanes, got, want[i]);
+	    }
+	}
+      else if (d > maxd)
+	maxd = d;
+    }
+  printf ("%-6s VL %4zu %-4s %s %zu lanes, %zu differ, max %.0f ulp, "
+	  "%zu failures\n", f->name, vl * 8, pass_names[p],
+	  nfail ? "FAIL" : "ok  ", n, ndiff, maxd, nfail);
+
+  free (xd);
+  free (yd);
+  free (rd);
+  free (ad);
+  free (xs);
+  free (ys);
+  free (rs);
+  free (as);
+  free (from);
+  return nfail != 0;
+}
+
+int
+main (int argc, char **argv)
+{
+  static const size_t vls[] = { 16, 32, 64 };
+  int opt, fail = 0, i, sel;
+  size_t k, v, n;
+  double *x, *y, *want;
+  enum pass p;
+
+  while ((opt = getopt (argc, argv, "n:")) != -1)
+    switch (opt)
+      {
+      case 'n':
+	samples = atol (optarg);
+	break;
+      default:
+	fprintf (stderr, "usage: %s [-n SAMPLES] [FUNCTION...]\n", argv[0]);
+	return 2;
+      }
+
+  /* The AdvSIMD reference takes the inputs four at a time.  */
+  n = (NSPECIAL + samples + 3) & ~(size_t) 3;
+  x = calloc (n, sizeof (double));
+  y = calloc (n, sizeof (double));
+  want = calloc (n, sizeof (double));
+  if (!x || !y || !want)
+    {
+      perror ("calloc");
+      return 2;
+    }
+
+  for (v = 0; v < sizeof (vls) / sizeof (vls[0]); v++)
+    {
+      int ret = prctl (PR_SVE_SET_VL, vls[v]);
+
+      if (ret < 0 || (size_t) (ret & PR_SVE_VL_LEN_MASK) != vls[v])
+	{
+	  printf ("VL %zu not available, skipped\n", vls[v] * 8);
+	  continue;
+	}
+      for (k = 0; k < sizeof (funcs) / sizeof (funcs[0]); k++)
+	{
+	  const struct func *f = &funcs[k];
+
+	  sel = optind == argc;
+	  for (i = optind; i < argc; i++)
+	    if (strcmp (argv[i], f->name) == 0)
+	      sel = 1;
+	  if (!sel)
+	    continue;
+
+	  /* The same inputs at every vector length.  */
+	  rng = 0x9e3779b97f4a7c15 + k;
+	  inputs (f, x, y, n);
+	  if (f->is_float)
+	    for (i = 0; (size_t) i < n; i++)
+	      {
+		x[i] = (float) x[i];
+		y[i] = (float) y[i];
+	      }
+	  reference (f, x, y, want, n);
+	  for (p = ALL; p < NPASS; p++)
+	    fail |= test (f, vls[v], p, x, y, want, n);
+	}
+    }
+  return fail;
+}
@@ -0,0 +1,692 @@
+/* Copyright (c) 2018, Marvell Technology Group Ltd.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ULP error of every lane of the _ZGVnN* entry points against the long
+   double libm functions.  Build with
+
+     gcc -O2 -pthread -o libmvec-ulp tests/libmvec_ulp.c libmvec.a -lm
+
+   where libmvec.a holds the libmvec objects, and run
+
+     ./libmvec-ulp [-j THREADS] [-n SAMPLES] [-s STRIDE] [-e] [FUNCTION...]
+
+   expf, exp2f, logf and log2f are tested on all 2^32 inputs, the
+   other float functions with -e too.  -s STRIDE tests every STRIDEth
+   input instead.  The double functions and the other float functions
+   get SAMPLES random inputs (default 2^22) spread over the intervals
+   listed for them, plus every input within 2^12 ulp of each listed
+   boundary: thresholds of the kernels, the ends of their near-one
+   paths, overflow and underflow limits.
+
+   For each function the harness prints the largest error, the input
+   where it occurs, and the result and reference there.  A nan, inf or
+   signed zero that does not match the reference counts as a special
+   mismatch.  The exit status is 1 if any function has a special
+   mismatch or exceeds the bound listed for it, which is the bound
+   documented in libmvec_util.h.  Build with -DLIBMVEC_LOW_ACCURACY to
+   check a library of that tier against its bounds.
+
+   On AArch64 long double is IEEE quad, so the reference error is far
+   below the reported precision.  Where long double is the x87 format
+   the reference for double functions carries an error of about
+   2^-11 ulp.  */
+
+#define _GNU_SOURCE
+#include <float.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+typedef double v2df __attribute__ ((vector_size (16)));
+typedef float v4sf __attribute__ ((vector_size (16)));
+
+#define DECL_V2DF(f) extern v2df _ZGVnN2v_##f (v2df);
+#define DECL_V2DF2(f) extern v2df _ZGVnN2vv_##f (v2df, v2df);
+#define DECL_V4SF(f) extern v4sf _ZGVnN4v_##f (v4sf);
+#define DECL_V4SF2(f) extern v4sf _ZGVnN4vv_##f (v4sf, v4sf);
+
+DECL_V2DF (exp) DECL_V2DF (exp2) DECL_V2DF (exp10) DECL_V2DF (expm1)
+DECL_V2DF (log) DECL_V2DF (log2) DECL_V2DF (log10) DECL_V2DF (log1p)
+DECL_V2DF2 (pow) DECL_V2DF (sin) DECL_V2DF (cos) DECL_V2DF (tan)
+DECL_V2DF (atan) DECL_V2DF2 (atan2) DECL_V2DF (asin) DECL_V2DF (acos)
+DECL_V2DF (sinh) DECL_V2DF (cosh) DECL_V2DF (tanh)
+DECL_V4SF (expf) DECL_V4SF (exp2f) DECL_V4SF (exp10f) DECL_V4SF (expm1f)
+DECL_V4SF (logf) DECL_V4SF (log2f) DECL_V4SF (log10f) DECL_V4SF (log1pf)
+DECL_V4SF2 (powf) DECL_V4SF (sinf) DECL_V4SF (cosf) DECL_V4SF (tanf)
+DECL_V4SF (atanf) DECL_V4SF2 (atan2f) DECL_V4SF (asinf) DECL_V4SF (acosf)
+DECL_V4SF (sinhf) DECL_V4SF (coshf) DECL_V4SF (tanhf)
+extern void _ZGVnN2vl8l8_sincos (v2df, double *, double *);
+extern void _ZGVnN4vl4l4_sincosf (v4sf, float *, float *);
+
+/* The sin and cos results of sincos, tested as two functions.  */
+static v2df
+sincos_sin (v2df x)
+{
+  double s[2], c[2];
+
+  _ZGVnN2vl8l8_sincos (x, s, c);
+  return (v2df) { s[0], s[1] };
+}
+
+static v2df
+sincos_cos (v2df x)
+{
+  double s[2], c[2];
+
+  _ZGVnN2vl8l8_sincos (x, s, c);
+  return (v2df) { c[0], c[1] };
+}
+
+static v4sf
+sincosf_sin (v4sf x)
+{
+  float s[4], c[4];
+
+  _ZGVnN4vl4l4_sincosf (x, s, c);
+  return (v4sf) { s[0], s[1], s[2], s[3] };
+}
+
+static v4sf
+sincosf_cos (v4sf x)
+{
+  float s[4], c[4];
+
+  _ZGVnN4vl4l4_sincosf (x, s, c);
+  return (v4sf) { c[0], c[1], c[2], c[3] };
+}
+
+/* Inputs: uniform in [LO, HI], or with LOG uniform in the exponent
+   between |LO| and |HI|, both signs if LO < 0.  */
+struct interval
+{
+  double lo, hi;
+  int log;
+};
+
+#define END { 0, 0, -1 }
+
+struct func
+{
+  const char *name;
+  int is_float;
+  int args;
+  void (*vec) (void);
+  long double (*ref) (void);
+  const struct interval *x, *y;
+  /* Boundaries, both signs are tested.  */
+  const double *bounds;
+  /* The documented bound in ulp.  */
+  double limit;
+  int exhaustive;
+};
+
+#ifdef LIBMVEC_LOW_ACCURACY
+# define TIER(bound, low) (low)
+#else
+# define TIER(bound, low) (bound)
+#endif
+
+#define FD(name, vec, ref, x, bounds, limit)				\
+  { name, 0, 1, (void (*) (void)) vec, (long double (*) (void)) ref,	\
+    x, NULL, bounds, limit, 0 }
+#define FD2(name, vec, ref, x, y, bounds, limit)			\
+  { name, 0, 2, (void (*) (void)) vec, (long double (*) (void)) ref,	\
+    x, y, bounds, limit, 0 }
+#define FF(name, vec, ref, x, bounds, limit, exhaustive)		\
+  { name, 1, 1, (void (*) (void)) vec, (long double (*) (void)) ref,	\
+    x, NULL, bounds, limit, exhaustive }
+#define FF2(name, vec, ref, x, y, bounds, limit)			\
+  { name, 1, 2, (void (*) (void)) vec, (long double (*) (void)) ref,	\
+    x, y, bounds, limit, 0 }
+
+static const struct interval i_exp[] =
+  { { -745.2, 709.8, 0 }, { -0x1p-60, 1, 1 }, END };
+static const struct interval i_exp2[] =
+  { { -1075, 1024, 0 }, { -0x1p-60, 1, 1 }, END };
+static const struct interval i_exp10[] =
+  { { -324, 308.3, 0 }, { -0x1p-60, 1, 1 }, END };
+static const struct interval i_expm1[] =
+  { { -40, 709.8, 0 }, { -0x1p-60, 1, 1 }, END };
+static const struct interval i_log[] =
+  { { 0x1p-1074, DBL_MAX, 1 }, { 0.5, 2, 0 }, END };
+static const struct interval i_log1p[] =
+  { { -1, 1, 0 }, { -0x1p-60, 1, 1 }, { 1, DBL_MAX, 1 }, END };
+static const struct interval i_pow_x[] =
+  { { 1e-10, 1e10, 1 }, { 0.5, 2, 0 }, END };
+static const struct interval i_pow_y[] =
+  { { -30, 30, 0 }, { -1000, 1000, 0 }, END };
+static const struct interval i_trig[] =
+  { { -1000, 1000, 0 }, { -0x1p-60, 1, 1 }, { -1e3, 1e300, 1 }, END };
+static const struct interval i_atan[] =
+  { { -0x1p-60, 1e300, 1 }, { -4, 4, 0 }, END };
+static const struct interval i_asin[] =
+  { { -1, 1, 0 }, { -0x1p-60, 1, 1 }, END };
+static const struct interval i_sinh[] =
+  { { -711, 711, 0 }, { -0x1p-60, 1, 1 }, END };
+static const struct interval i_tanh[] =
+  { { -22, 22, 0 }, { -0x1p-60, 1, 1 }, END };
+
+static const struct interval f_expm1[] =
+  { { -20, 88.8, 0 }, { -0x1p-30, 1, 1 }, END };
+static const struct interval f_exp10[] =
+  { { -46, 38.6, 0 }, { -0x1p-30, 1, 1 }, END };
+static const struct interval f_log[] =
+  { { 0x1p-149, FLT_MAX, 1 }, { 0.5, 2, 0 }, END };
+static const struct interval f_log1p[] =
+  { { -1, 1, 0 }, { -0x1p-30, 1, 1 }, { 1, FLT_MAX, 1 }, END };
+static const struct interval f_pow_x[] =
+  { { 1e-5, 1e5, 1 }, { 0.5, 2, 0 }, END };
+static const struct interval f_pow_y[] =
+  { { -10, 10, 0 }, { -150, 150, 0 }, END };
+static const struct interval f_trig[] =
+  { { -100, 100, 0 }, { -0x1p-30, 1, 1 }, { -1e2, FLT_MAX, 1 }, END };
+static const struct interval f_atan[] =
+  { { -0x1p-30, FLT_MAX, 1 }, { -4, 4, 0 }, END };
+static const struct interval f_sinh[] =
+  { { -89.5, 89.5, 0 }, { -0x1p-30, 1, 1 }, END };
+static const struct interval f_tanh[] =
+  { { -12, 12, 0 }, { -0x1p-30, 1, 1 }, END };
+
+static const double b_exp[] =
+  { 0x1.62e42fefa39efp9, 0x1.6232bdd7abcd2p9, 0x1.74910d52d3051p9, 512,
+    0x1p-54, 0 };
+static const double b_exp2[] = { 1024, 1022, 1075, 512, 0x1p-54, 0 };
+static const double b_exp10[] =
+  { 0x1.34413509f79fep8, 0x1.33a7146f72a42p8, 0x1.439b746e36b52p8, 220,
+    0x1p-54, 0 };
+static const double b_expm1[] =
+  { 0x1.62e42fefa39efp9, 40, 512, 0x1p-4, 0x1p-54, 0 };
+static const double b_log[] =
+  { 1, 1 - 0x1p-4, 1 + 0x1.09p-4, 1 - 0x1.5b51p-5, 1 + 0x1.6ab2p-5,
+    DBL_MIN, DBL_MAX, 0 };
+static const double b_log1p[] =
+  { 0x1p-4, 0x1.09p-4, 1, DBL_MIN, DBL_MAX, 0 };
+static const double b_pow[] = { 1, 2, 0.5, 0 };
+static const double b_trig[] =
+  { 1000, 0x1.921fb54442d18p0, 0x1.921fb54442d18p1, 0x1.2d97c7f3321d2p2,
+    0x1.921fb54442d18p2, 0x1p-26, 0 };
+static const double b_atan[] = { 1, 0x1p-26, 0x1p54, 0 };
+static const double b_asin[] = { 1, 0.5, 0x1p-26, 0 };
+static const double b_sinh[] =
+  { 0x1.633ce8fb9f87dp9, 512, 20, 0x1p-4, 0x1p-26, 0 };
+
+static const double bf_exp[] =
+  { 0x1.62e42ep6, 0x1.9fe368p6, 0x1.5d589ep6, 0x1p-25, 0 };
+static const double bf_exp2[] = { 128, 126, 149, 150, 0x1p-25, 0 };
+static const double bf_exp10[] =
+  { 0x1.344136p5, 0x1.2f7030p5, 0x1.66d3e8p5, 0x1p-25, 0 };
+static const double bf_expm1[] = { 0x1.62e42ep6, 0x1p-4, 0x1p-25, 0 };
+static const double bf_log[] =
+  { 1, 0x1.66p-1, 0x1.555556p-1, FLT_MIN, FLT_MAX, 0 };
+static const double bf_log1p[] = { 0x1p-4, 1, FLT_MIN, FLT_MAX, 0 };
+static const double bf_pow[] = { 1, 2, 0.5, 0 };
+static const double bf_trig[] =
+  { 0x1p20, 0x1.921fb6p0, 0x1.921fb6p1, 0x1.921fb6p2, 0x1p-12, 0 };
+static const double bf_atan[] = { 1, 0x1p-12, 0x1p25, 0 };
+static const double bf_asin[] = { 1, 0.5, 0x1p-12, 0 };
+static const double bf_sinh[] = { 0x1.65a9fap6, 10, 0x1p-4, 0x1p-12, 0 };
+
+static long double
+sincos_sinl (long double x)
+{
+  return sinl (x);
+}
+
+static long double
+sincos_cosl (long double x)
+{
+  return cosl (x);
+}
+
+static const struct func funcs[] = {
+  FD ("exp", _ZGVnN2v_exp, expl, i_exp, b_exp, TIER (0.52, 2.1)),
+  FD ("exp2", _ZGVnN2v_exp2, exp2l, i_exp2, b_exp2, TIER (0.52, 1.3)),
+  FD ("exp10", _ZGVnN2v_exp10, exp10l, i_exp10, b_exp10,
+       TIER (0.52, 2.1)),
+  FD ("expm1", _ZGVnN2v_expm1, expm1l, i_expm1, b_expm1, 0.6),
+  FD ("log", _ZGVnN2v_log, logl, i_log, b_log, TIER (0.53, 2.8)),
+  FD ("log2", _ZGVnN2v_log2, log2l, i_log, b_log, TIER (0.58, 2.9)),
+  FD ("log10", _ZGVnN2v_log10, log10l, i_log, b_log, 0.55),
+  FD ("log1p", _ZGVnN2v_log1p, log1pl, i_log1p, b_log1p, 0.58),
+  FD2 ("pow", _ZGVnN2vv_pow, powl, i_pow_x, i_pow_y, b_pow, 0.52),
+  FD ("sin", _ZGVnN2v_sin, sinl, i_trig, b_trig, 1.55),
+  FD ("cos", _ZGVnN2v_cos, cosl, i_trig, b_trig, 1.55),
+  FD ("sincos.sin", sincos_sin, sincos_sinl, i_trig, b_trig, 1.55),
+  FD ("sincos.cos", sincos_cos, sincos_cosl, i_trig, b_trig, 1.55),
+  FD ("tan", _ZGVnN2v_tan, tanl, i_trig, b_trig, 3),
+  FD ("atan", _ZGVnN2v_atan, atanl, i_atan, b_atan, 0.85),
+  FD2 ("atan2", _ZGVnN2vv_atan2, atan2l, i_atan, i_atan, b_atan, 1.5),
+  FD ("asin", _ZGVnN2v_asin, asinl, i_asin, b_asin, 0.7),
+  FD ("acos", _ZGVnN2v_acos, acosl, i_asin, b_asin, 0.7),
+  FD ("sinh", _ZGVnN2v_sinh, sinhl, i_sinh, b_sinh, 2.2),
+  FD ("cosh", _ZGVnN2v_cosh, coshl, i_sinh, b_sinh, 1.05),
+  FD ("tanh", _ZGVnN2v_tanh, tanhl, i_tanh, b_sinh, 2.4),
+  FF ("expf", _ZGVnN4v_expf, expl, NULL, bf_exp, TIER (0.51, 2.3), 1),
+  FF ("exp2f", _ZGVnN4v_exp2f, exp2l, NULL, bf_exp2, TIER (0.51, 2.2), 1),
+  FF ("exp10f", _ZGVnN4v_exp10f, exp10l, f_exp10, bf_exp10, 0.51, 0),
+  FF ("expm1f", _ZGVnN4v_expm1f, expm1l, f_expm1, bf_expm1, 0.52, 0),
+  FF ("logf", _ZGVnN4v_logf, logl, NULL, bf_log, TIER (0.9, 1.5), 1),
+  FF ("log2f", _ZGVnN4v_log2f, log2l, NULL, bf_log, TIER (0.76, 2.6), 1),
+  FF ("log10f", _ZGVnN4v_log10f, log10l, f_log, bf_log, 1.0, 0),
+  FF ("log1pf", _ZGVnN4v_log1pf, log1pl, f_log1p, bf_log1p, 0.75, 0),
+  FF2 ("powf", _ZGVnN4vv_powf, powl, f_pow_x, f_pow_y, bf_pow, 0.52),
+  FF ("sinf", _ZGVnN4v_sinf, sinl, f_trig, bf_trig, 2, 0),
+  FF ("cosf", _ZGVnN4v_cosf, cosl, f_trig, bf_trig, 2, 0),
+  FF ("sincosf.sin", sincosf_sin, sincos_sinl, f_trig, bf_trig, 2, 0),
+  FF ("sincosf.cos", sincosf_cos, sincos_cosl, f_trig, bf_trig, 2, 0),
+  FF ("tanf", _ZGVnN4v_tanf, tanl, f_trig, bf_trig, 0.51, 0),
+  FF ("atanf", _ZGVnN4v_atanf, atanl, f_atan, bf_atan, 0.51, 0),
+  FF2 ("atan2f", _ZGVnN4vv_atan2f, atan2l, f_atan, f_atan, bf_atan, 0.51),
+  FF ("asinf", _ZGVnN4v_asinf, asinl, f_log1p, bf_asin, 0.51, 0),
+  FF ("acosf", _ZGVnN4v_acosf, acosl, f_log1p, bf_asin, 0.51, 0),
+  FF ("sinhf", _ZGVnN4v_sinhf, sinhl, f_sinh, bf_sinh, 0.52, 0),
+  FF ("coshf", _ZGVnN4v_coshf, coshl, f_sinh, bf_sinh, 0.51, 0),
+  FF ("tanhf", _ZGVnN4v_tanhf, tanhl, f_tanh, bf_sinh, 0.52, 0),
+};
+
+/* The worst lane seen by one thread, and its special mismatches.  */
+struct result
+{
+  double err;
+  double x, y, got;
+  long double want;
+  uint64_t special, tested;
+  double sx, sy, sgot;
+  long double swant;
+};
+
+static long samples = 1L << 22;
+static long stride = 1;
+static int exhaustive_all;
+static int nthreads;
+
+#define BOUNDARY_ULPS 4096
+
+/* Error of GOT in ulp of the format of F, or -1 for a special
+   mismatch.  An infinite GOT counts as 2^1024 (2^128) unless the
+   reference is past the overflow threshold.  */
+static double
+ulp_error (const struct func *f, double got, long double want)
+{
+  int mant = f->is_float ? 23 : 52;
+  int emin = f->is_float ? -126 : -1022;
+  int emax = f->is_float ? 128 : 1024;
+  long double g = got;
+  int e;
+
+  if (isnan (want) || isnan (got))
+    return isnan (want) && isnan (got) ? 0 : -1;
+  if (isinf (want))
+    return got == want ? 0 : -1;
+  if (want == 0)
+    return got == 0 && !signbit (got) == !signbit (want) ? 0 : -1;
+  /* Past the overflow threshold the result rounds to inf.  */
+  if (fabsl (want) >= ldexpl (1.0L, emax) - ldexpl (1.0L, emax - mant - 2)
+      && got == copysign (INFINITY, (double) want))
+    return 0;
+  if (isinf (got))
+    g = copysignl (ldexpl (1.0L, emax), got);
+  e = ilogbl (want);
+  if (e < emin)
+    e = emin;
+  if (e >= emax)
+    e = emax - 1;
+  return fabsl (g - want) / ldexpl (1.0L, e - mant);
+}
+
+static void
+record (const struct func *f, struct result *r, double x, double y,
+	double got)
+{
+  long double want;
+  double err;
+
+  if (f->args == 2)
+    want = ((long double (*) (long double, long double)) f->ref) (x, y);
+  else
+    want = ((long double (*) (long double)) f->ref) (x);
+  r->tested++;
+  err = ulp_error (f, got, want);
+  if (err < 0)
+    {
+      if (r->special++ == 0)
+	{
+	  r->sx = x;
+	  r->sy = y;
+	  r->sgot = got;
+	  r->swant = want;
+	}
+    }
+  else if (err > r->err)
+    {
+      r->err = err;
+      r->x = x;
+      r->y = y;
+      r->got = got;
+      r->want = want;
+    }
+}
+
+/* Evaluate F on a batch of NX lanes and record every lane.  */
+static void
+eval (const struct func *f, struct result *r, const double *x,
+      const double *y)
+{
+  if (f->is_float)
+    {
+      v4sf vx = { x[0], x[1], x[2], x[3] };
+      v4sf vy = { y[0], y[1], y[2], y[3] };
+      v4sf vr;
+      int i;
+
+      if (f->args == 2)
+	vr = ((v4sf (*) (v4sf, v4sf)) f->vec) (vx, vy);
+      else
+	vr = ((v4sf (*) (v4sf)) f->vec) (vx);
+      for (i = 0; i < 4; i++)
+	record (f, r, vx[i], vy[i], vr[i]);
+    }
+  else
+    {
+      v2df vx = { x[0], x[1] };
+      v2df vy = { y[0], y[1] };
+      v2df vr;
+      int i;
+
+      if (f->args == 2)
+	vr = ((v2df (*) (v2df, v2df)) f->vec) (vx, vy);
+      else
+	vr = ((v2df (*) (v2df)) f->vec) (vx);
+      for (i = 0; i < 2; i++)
+	record (f, r, vx[i], vy[i], vr[i]);
+    }
+}
+
+static uint64_t
+rng (uint64_t *s)
+{
+  *s ^= *s << 13;
+  *s ^= *s >> 7;
+  *s ^= *s << 17;
+  return *s;
+}
+
+static double
+sample (const struct interval *iv, int n, uint64_t *s)
+{
+  const struct interval *i = &iv[rng (s) % n];
+  double u = (rng (s) >> 11) * 0x1p-53;
+
+  if (i->log)
+    {
+      double lo = fabs (i->lo), hi = fabs (i->hi);
+      int elo = ilogb (lo), ehi = ilogb (hi);
+      double x;
+
+      do
+	x = ldexp (1 + u, elo + (int) (rng (s) % (ehi - elo + 1)));
+      while (x < lo || x > hi);
+      if (i->lo < 0 && (rng (s) & 1))
+	x = -x;
+      return x;
+    }
+  return i->lo + u * (i->hi - i->lo);
+}
+
+static int
+count (const struct interval *iv)
+{
+  int n = 0;
+
+  while (iv[n].log >= 0)
+    n++;
+  return n;
+}
+
+/* X moved by STEP ulp of its format, X >= 0.  */
+static double
+step_ulps (const struct func *f, double x, int step)
+{
+  if (f->is_float)
+    {
+      float v = x;
+      uint32_t b;
+
+      memcpy (&b, &v, sizeof (b));
+      if (step < 0 && b < (uint32_t) -step)
+	return 0;
+      b += step;
+      memcpy (&v, &b, sizeof (v));
+      return v;
+    }
+  else
+    {
+      uint64_t b;
+
+      memcpy (&b, &x, sizeof (b));
+      if (step < 0 && b < (uint64_t) -step)
+	return 0;
+      b += step;
+      memcpy (&x, &b, sizeof (x));
+      return x;
+    }
+}
+
+struct job
+{
+  const struct func *f;
+  int id;
+  struct result r;
+};
+
+static void *
+run (void *arg)
+{
+  struct job *j = arg;
+  const struct func *f = j->f;
+  int lanes = f->is_float ? 4 : 2;
+  double x[4], y[4];
+  int k = 0;
+
+  memset (&j->r, 0, sizeof (j->r));
+  if (f->exhaustive || (f->is_float && f->args == 1 && exhaustive_all))
+    {
+      uint64_t n = 1ULL << 32, lo = n * j->id / nthreads;
+      uint64_t hi = n * (j->id + 1) / nthreads, i;
+
+      lo = (lo + stride - 1) / stride * stride;
+      for (i = lo; i < hi; i += stride)
+	{
+	  uint32_t b = i;
+	  float v;
+
+	  memcpy (&v, &b, sizeof (v));
+	  x[k] = v;
+	  y[k] = 0;
+	  if (++k == lanes)
+	    {
+	      eval (f, &j->r, x, y);
+	      k = 0;
+	    }
+	}
+    }
+  else
+    {
+      uint64_t s = 0x9e3779b97f4a7c15ULL * (j->id + 1);
+      int nx = count (f->x), ny = f->y ? count (f->y) : 0;
+      long i, n = samples / nthreads;
+
+      for (i = 0; i < n; i++)
+	{
+	  x[k] = sample (f->x, nx, &s);
+	  y[k] = f->y ? sample (f->y, ny, &s) : 0;
+	  if (f->is_float)
+	    {
+	      x[k] = (float) x[k];
+	      y[k] = (float) y[k];
+	    }
+	  if (++k == lanes)
+	    {
+	      eval (f, &j->r, x, y);
+	      k = 0;
+	    }
+	}
+    }
+
+  /* The boundaries, split between the threads.  The second argument
+     of pow and atan2 is 1.5 and -3, a boundary for the first.  */
+  {
+    const double *b;
+    int bi = 0;
+
+    for (b = f->bounds; ; b++, bi++)
+      {
+	int sign, step;
+
+	if (bi % nthreads != j->id)
+	  {
+	    if (*b == 0)
+	      break;
+	    continue;
+	  }
+	for (sign = -1; sign <= 1; sign += 2)
+	  for (step = -BOUNDARY_ULPS; step <= BOUNDARY_ULPS; step++)
+	    {
+	      double v = step_ulps (f, *b, step) * sign;
+
+	      x[k] = v;
+	      y[k] = (step & 1) ? 1.5 : -3;
+	      if (++k == lanes)
+		{
+		  eval (f, &j->r, x, y);
+		  k = 0;
+		}
+	    }
+	if (*b == 0)
+	  break;
+      }
+  }
+  return NULL;
+}
+
+static int
+test (const struct func *f)
+{
+  struct job *jobs = calloc (nthreads, sizeof (*jobs));
+  pthread_t *tids = calloc (nthreads, sizeof (*tids));
+  struct result r;
+  int i, fail;
+
+  for (i = 0; i < nthreads; i++)
+    {
+      jobs[i].f = f;
+      jobs[i].id = i;
+      pthread_create (&tids[i], NULL, run, &jobs[i]);
+    }
+  memset (&r, 0, sizeof (r));
+  for (i = 0; i < nthreads; i++)
+    {
+      struct result *t = &jobs[i].r;
+
+      pthread_join (tids[i], NULL);
+      r.tested += t->tested;
+      if (t->special && r.special == 0)
+	{
+	  r.sx = t->sx;
+	  r.sy = t->sy;
+	  r.sgot = t->sgot;
+	  r.swant = t->swant;
+	}
+      r.special += t->special;
+      if (t->err > r.err)
+	{
+	  r.err = t->err;
+	  r.x = t->x;
+	  r.y = t->y;
+	  r.got = t->got;
+	  r.want = t->want;
+	}
+    }
+
+  fail = r.special != 0 || r.err > f->limit;
+  printf ("%-12s %s max %.3f ulp (bound %.2f) at x=%a", f->name,
+	  fail ? "FAIL" : "ok  ", r.err, f->limit, r.x);
+  if (f->args == 2)
+    printf (" y=%a", r.y);
+  printf (" got %a want %La, %llu lanes\n", r.got, r.want,
+	  (unsigned long long) r.tested);
+  if (r.special)
+    {
+      printf ("%-12s      %llu special mismatches, first at x=%a",
+	      f->name, (unsigned long long) r.special, r.sx);
+      if (f->args == 2)
+	printf (" y=%a", r.sy);
+      printf (" got %a want %La\n", r.sgot, r.swant);
+    }
+  fflush (stdout);
+  free (jobs);
+  free (tids);
+  return fail;
+}
+
+int
+main (int argc, char **argv)
+{
+  int opt, fail = 0, i;
+  size_t k;
+
+  nthreads = sysconf (_SC_NPROCESSORS_ONLN);
+  while ((opt = getopt (argc, argv, "j:n:s:e")) != -1)
+    switch (opt)
+      {
+      case 'j':
+	nthreads = atoi (optarg);
+	break;
+      case 'n':
+	samples = atol (optarg);
+	break;
+      case 's':
+	stride = atol (optarg);
+	break;
+      case 'e':
+	exhaustive_all = 1;
+	break;
+      default:
+	fprintf (stderr, "usage: %s [-j THREADS] [-n SAMPLES] [-s STRIDE]"
+		 " [-e] [FUNCTION...]\n", argv[0]);
+	return 2;
+      }
+  if (nthreads < 1)
+    nthreads = 1;
+  if (stride < 1)
+    stride = 1;
+
+  for (k = 0; k < sizeof (funcs) / sizeof (funcs[0]); k++)
+    {
+      int sel = optind == argc;
+
+      for (i = optind; i < argc; i++)
+	if (strcmp (argv[i], funcs[k].name) == 0)
+	  sel = 1;
+      if (sel)
+	fail |= test (&funcs[k]);
+    }
+  return fail;
+}